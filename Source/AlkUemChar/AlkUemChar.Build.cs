@@ -18,12 +18,20 @@ public class AlkUemChar : ModuleRules
       "CoreUObject",
       "Engine",
       "HeadMountedDisplay",
+      "NavigationSystem",
+      "RenderCore",
       "AboaUem",
       "AlkUemPure"
     });
     PublicDependencyModuleNames.AddRange(new string[] {
       "VRExpansionPlugin"
     });
+    if (Target.bBuildEditor) {
+      PrivateDependencyModuleNames.Add("DirectoryWatcher");
+        // ^ !!! invalidates the cached alkchar.aboa when edited
+      PrivateDependencyModuleNames.Add("UnrealEd");
+        // ^ !!! PIE sessions in Tests/AlkIntentsTest.cpp
+    }
     RuntimeDependencies.Add(
       PluginDirectory + "/Source/aboa/alkchar.aboa");
     //OptimizeCode = CodeOptimization.Never;
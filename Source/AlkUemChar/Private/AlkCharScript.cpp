@@ -0,0 +1,161 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#include "AlkCharScript.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Paths.h"
+#if WITH_EDITOR
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#include "Modules/ModuleManager.h"
+#endif
+
+#include "aboa-ue.h"
+#include "aboa-ue-helper.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAlkCharScript, Log, All);
+
+namespace alkchar {
+
+uint32 ScriptGeneration = 0;
+
+static TMap<FString, FDateTime> ScriptCacheTimestamps;
+static bool ScriptPickRayTargetSubscribedCached = false;
+static uint32 ScriptPickRayTargetQueriedGeneration = MAX_uint32;
+static FDelegateHandle ScriptCachePostEngineInitHandle;
+#if WITH_EDITOR
+static FString ScriptCacheWatchedDirectory;
+static FDelegateHandle ScriptCacheWatcherHandle;
+#endif
+
+auto ScriptFilePath(char const * const filename) -> FString {
+  return PluginFilePath("AlkalineBaseUE", "Source/aboa", filename);
+}
+
+auto ScriptCacheAcquireReload(FString const & path, FDateTime & stamp) -> bool {
+  auto const cached = ScriptCacheTimestamps.Find(path);
+#if WITH_EDITOR
+  // !!! the watcher invalidates, but also catch edits it missed
+  stamp = IFileManager::Get().GetTimeStamp(*path);
+  return !cached || *cached != stamp;
+#else
+  // !!! shipping scripts never change under a running process
+  if (cached)
+    return false;
+  stamp = IFileManager::Get().GetTimeStamp(*path);
+  return true;
+#endif
+}
+
+void ScriptCacheLoaded(
+  FString const & path,
+  FDateTime const & stamp,
+  bool const succeeded
+) {
+  if (succeeded && stamp != FDateTime::MinValue()) // !!! min when missing
+    ScriptCacheTimestamps.Add(path, stamp);
+  else {
+    UE_LOG(LogAlkCharScript, Warning,
+      TEXT("cannot load %s, retried on next use"), *path);
+    ScriptCacheTimestamps.Remove(path);
+  }
+}
+
+void ScriptCacheInvalidate(FString const & path) {
+  ScriptCacheTimestamps.Remove(path);
+}
+
+auto ScriptPickRayTargetSubscribed(ScriptCallSite & query) -> bool {
+  if (ScriptPickRayTargetQueriedGeneration == ScriptGeneration)
+    return ScriptPickRayTargetSubscribedCached;
+  ScriptPickRayTargetSubscribedCached =
+    query.CallForResultString().TrimStartAndEnd() != TEXT("none");
+  ScriptPickRayTargetQueriedGeneration = ScriptGeneration;
+  return ScriptPickRayTargetSubscribedCached;
+}
+
+void ScriptPickRayTargetSubscriptionChanged(bool const subscribed) {
+  ScriptSubscriptionsInvalidate();
+  ScriptPickRayTargetSubscribedCached = subscribed;
+  ScriptPickRayTargetQueriedGeneration = ScriptGeneration; // !!! no query
+}
+
+void ScriptSubscriptionsInvalidate() {
+  ++ScriptGeneration;
+  ScriptPickRayTargetSubscribedCached = false;
+}
+
+#if WITH_EDITOR
+static void ScriptCacheOnDirectoryChanged(
+  TArray<FFileChangeData> const & changes
+) {
+  for (auto const & change : changes) {
+    auto path = change.Filename;
+    FPaths::NormalizeFilename(path);
+    for (auto const & entry : ScriptCacheTimestamps) {
+      auto cachedPath = entry.Key;
+      FPaths::NormalizeFilename(cachedPath);
+      if (FPaths::IsSamePath(cachedPath, path)) {
+        auto const key = entry.Key; // !!! entry dies with the removal
+        ScriptCacheInvalidate(key);
+        break; // !!! iterator invalid after removal
+      }
+    }
+  }
+}
+#endif
+
+static void ScriptCachePreload() {
+  // !!! parse and evaluate once, shared by every AAlkCharacter
+  auto const path = ScriptFilePath("alkchar.aboa");
+  FDateTime stamp;
+  auto const reload = ScriptCacheAcquireReload(path, stamp);
+  auto results = runCachedAboaUeCodeAtPath(
+    path, "alkchar-load",
+    makeAboaUeDataDict({}),
+    reload);
+  if (reload)
+    ScriptCacheLoaded(path, stamp, ScriptSucceeded(results));
+  ScriptSubscriptionsInvalidate();
+}
+
+void ScriptCacheStartup() {
+  // !!! the Aboa runtime is not guaranteed ready until the engine is
+  ScriptCachePostEngineInitHandle =
+    FCoreDelegates::OnPostEngineInit.AddStatic(&ScriptCachePreload);
+#if WITH_EDITOR
+  auto & watcherModule =
+    FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(
+      TEXT("DirectoryWatcher"));
+  auto const watcher = watcherModule.Get();
+  if (watcher) {
+    ScriptCacheWatchedDirectory =
+      FPaths::GetPath(ScriptFilePath("alkchar.aboa"));
+    watcher->RegisterDirectoryChangedCallback_Handle(
+      ScriptCacheWatchedDirectory,
+      IDirectoryWatcher::FDirectoryChanged::CreateStatic(
+        &ScriptCacheOnDirectoryChanged),
+      ScriptCacheWatcherHandle);
+  }
+#endif
+}
+
+void ScriptCacheShutdown() {
+  FCoreDelegates::OnPostEngineInit.Remove(ScriptCachePostEngineInitHandle);
+#if WITH_EDITOR
+  auto const watcherModule =
+    FModuleManager::GetModulePtr<FDirectoryWatcherModule>(
+      TEXT("DirectoryWatcher"));
+  if (watcherModule && watcherModule->Get())
+    watcherModule->Get()->UnregisterDirectoryChangedCallback_Handle(
+      ScriptCacheWatchedDirectory, ScriptCacheWatcherHandle);
+#endif
+  ScriptCacheTimestamps.Empty();
+}
+
+}; // end namespace alkchar
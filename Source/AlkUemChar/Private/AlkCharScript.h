@@ -0,0 +1,91 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <type_traits>
+#include <utility>
+
+#include "aboa-ue.h"
+#include "aboa-ue-helper.h"
+
+#include "AlkCharacterStats.h"
+
+namespace alkchar {
+
+auto ScriptFilePath(char const * const filename) -> FString;
+
+// !!! keyed on path and modification time; returns true only when the
+// !!! caller must (re)load, then reports the outcome to ScriptCacheLoaded
+// !!! with the stamp read here so a failed load is retried next time
+auto ScriptCacheAcquireReload(FString const & path, FDateTime & stamp) -> bool;
+void ScriptCacheLoaded(
+  FString const & path, FDateTime const & stamp, bool const succeeded);
+
+// !!! alkchar-load and alkchar-init end by returning ScriptLoadedSentinel,
+// !!! so a "result" without it means the file did not parse or evaluate
+inline constexpr TCHAR const * ScriptLoadedSentinel = TEXT("alkchar-loaded");
+
+template <typename Results>
+auto ScriptSucceeded(Results & results) -> bool {
+  return stringFromAboaUeDataDict(results, "result").TrimStartAndEnd()
+    == ScriptLoadedSentinel;
+}
+
+void ScriptCacheInvalidate(FString const & path);
+
+extern uint32 ScriptGeneration; // !!! bumped when subscriptions changed
+
+void ScriptCacheStartup();   // !!! from module startup
+void ScriptCacheShutdown();  // !!! from module shutdown
+
+// !!! one script hook whose argument dict is built once (e.g. at character
+// !!! init) and then only has its slots overwritten in place before each
+// !!! call, so the keys and the container are never rebuilt per call
+struct ScriptCallSite {
+  using Args = decltype(makeAboaUeDataDict({}));
+  using Arg = std::remove_reference_t<decltype(std::declval<Args &>()[""])>;
+
+  char const * const Symbol; // !!! a literal, alive for the process
+  Args Arguments;
+
+  ScriptCallSite(char const * const symbol, Args && args)
+    : Symbol(symbol), Arguments(std::move(args)) {}
+  ScriptCallSite(ScriptCallSite const &) = delete;
+  auto operator=(ScriptCallSite const &) -> ScriptCallSite & = delete;
+
+  auto Slot(char const * const key) -> Arg & {
+    // !!! resolve at setup and keep the reference, node-based dict values
+    // !!! stay put because the key set never changes after construction
+    return Arguments[key];
+  }
+
+  void Call() { // !!! the results dict is dropped unread
+    ALK_STAT_SCOPE(ScriptCall);
+    ALK_STAT_COUNT(ScriptCalls, 1);
+    callLoadedAboaUeCode(Symbol, Arguments);
+  }
+
+  auto CallForResultString() -> FString {
+    ALK_STAT_SCOPE(ScriptCall);
+    ALK_STAT_COUNT(ScriptCalls, 1);
+    auto result = stringFromAboaUeDataDict(
+      callLoadedAboaUeCode(Symbol, Arguments), "result");
+    return result;
+  }
+};
+
+// !!! process-wide: does any script listener subscribe to
+// !!! alkchar-pick-ray-target; asked through query only after the script
+// !!! loaded or alkchar-init ran, in between alkchar.aboa reports every
+// !!! subscribe and unsubscribe through AlkScriptSubscriptionChanged
+auto ScriptPickRayTargetSubscribed(ScriptCallSite & query) -> bool;
+void ScriptPickRayTargetSubscriptionChanged(bool const subscribed);
+void ScriptSubscriptionsInvalidate(); // !!! e.g. after alkchar-init
+
+}; // end namespace alkchar
@@ -7,72 +7,316 @@
 #include "AlkCharacter.h"
 
 #include "EngineMinimal.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/GameStateBase.h"
 #include "GameFramework/InputSettings.h"
 #include "HeadMountedDisplayFunctionLibrary.h"
 #include "IXRTrackingSystem.h"
-#include "Kismet/KismetSystemLibrary.h" // for PrintString(...)
+#include "Kismet/KismetSystemLibrary.h" // for LineTraceSingle(...)
+#include "NavigationSystem.h"
+#include "Net/UnrealNetwork.h"
+#include "Serialization/MemoryWriter.h"
+#include "TimerManager.h"
 //#include "VRNotificationsComponent.h"
 
 #include "GripMotionControllerComponent.h"
 //#include "VRExpansionFunctionLibrary.h" // for IsInVREditorPreviewOrGame, but we don't use it
 
+#include "AlkCharScript.h"
+#include "AlkCharacterTimers.h"
+#include "AlkCharacterStats.h"
+#include "AlkHMDPresence.h"
+#include "AlkInputRecorder.h"
+#include "AlkIntents.h"
+#include "AlkPickable.h"
+#include "AlkPickRaySubsystem.h"
+#include "AlkProjectilePool.h"
+#include "AlkTrace.h"
 #include "AlkPureMath.h"
+#include "AlkPureView.h"
+#include "AlkPureViewport.h"
 #include "AlkPureWorld.h"
 
 #include "aboa-ue.h"
 #include "aboa-ue-helper.h"
 
+DEFINE_LOG_CATEGORY_STATIC(LogAlkCharacter, Log, All);
+
 constexpr int HMDUpdateFrequencySeconds = 1.f;
 
-static auto codeFilePath(char const * const filename) -> FString {
-  return PluginFilePath("AlkalineBaseUE", "Source/aboa", filename);
+// !!! rows that can never act, warned about when the table loads
+static void WarnUnsupportedTouchGestures(AAlkCharacter const & character) {
+  for (auto i = 0; i < character.AlkTouchGestures.Num(); ++i) {
+    auto const & binding = character.AlkTouchGestures[i];
+    auto const gesture = UEnum::GetValueAsString(binding.Gesture);
+    if (   (   binding.Gesture == EAlkTouchGesture::Tap
+            || binding.Gesture == EAlkTouchGesture::Hold)
+        && binding.Action != EAlkTouchGestureAction::Notify
+        && binding.Action != EAlkTouchGestureAction::None)
+      UE_LOG(LogAlkCharacter, Warning,
+        TEXT("%s: AlkTouchGestures[%d] %s only supports Notify, ignored"),
+        *character.GetName(), i, *gesture);
+    if (   (   binding.Gesture == EAlkTouchGesture::Pinch
+            || binding.Gesture == EAlkTouchGesture::Rotate)
+        && binding.Fingers == 1)
+      UE_LOG(LogAlkCharacter, Warning,
+        TEXT("%s: AlkTouchGestures[%d] %s needs two fingers, never recognized"),
+        *character.GetName(), i, *gesture);
+  }
 }
 
 struct AAlkCharacterImpl: AAlkCharacter::Impl {
   float AutoForwardLevel = 1.f;
   float AutoForwardValue = 0.f;
   int Options = 0;
+  bool bMouseDirty            = false;
   bool bMouseMovingEnabled    = false;
   bool bMouseTurningEnabled   = false;
   bool bMovingForward         = false;
   bool bMovingRight           = false;
   bool bTurningBodyNotCamera  = false;
   struct HMDState {
-    FRotator Orientation;
-    FVector Position;
-    float UpdateDeltaSeconds = 0.f;
-    float UpdateTotalSeconds = 0.f;
     bool Worn = false;
   };
   struct HMDState HMDState;
+  AlkHMDPresence HMDPresence;
   bool FireMeasuring = false;
   int FireRapidCount = 0;
   int FireRapidCurrent = 0;
   float FireSeconds = 0.f;
   bool HoldMeasuring = false;
   float HoldSeconds = 0.f;
+  TWeakObjectPtr<UAlkCharacterTimers> Timers; // !!! with bAlkBatchedTimers
+  int32 TimersSlot = INDEX_NONE;
+  TWeakObjectPtr<UAlkIntentValidator> IntentValidator; // !!! server only
+  int32 IntentValidatorSlot = INDEX_NONE;
+  TArray<FAlkIntent> PendingIntents; // !!! owning client, until sent
+  float IntentsPendingSeconds = 0.f;
   ETouchIndex::Type FingerIndexFire = ETouchIndex::Touch1;
-  ETouchIndex::Type FingerIndexMove = ETouchIndex::Touch2;
-  ETouchIndex::Type FingerIndexMoveOnly = ETouchIndex::Touch3;
-  ETouchIndex::Type FingerIndexTurn = ETouchIndex::Touch1;
   struct TouchFingerState {
     ETouchIndex::Type FingerIndex = ETouchIndex::CursorPointerIndex;
     FVector Location = FVector::ZeroVector;
+    FVector FrameLocation = FVector::ZeroVector; // !!! at the previous pass
     bool bDragged = false;
     bool bPressed = false;
+    bool bHoldRecognized = false;
     float PressedRealTimeSeconds = 0.f;
   };
-  struct TouchFingerState TouchFingerStates[ETouchIndex::MAX_TOUCHES];
   FVector2D ViewportDragThresholdRatio;
   FVector2D ViewportDivisor;
+  uint32 ViewportVersion = 0; // !!! of the metrics ViewportDivisor came from
+  pure::ViewProjection ViewProjection;
+  uint64 ViewProjectionFrame = MAX_uint64;
   FVector2D ViewportMousePosition;
-  FHitResult PickRayHitResultTick;
+  struct HoldMoveAccumulator { // !!! mouse and touch moves of one frame
+    FVector2D Delta = FVector2D::ZeroVector; // !!! viewport ratio
+    FVector2D Position = FVector2D::ZeroVector; // !!! the latest
+    bool bPending = false;
+  };
+  struct HoldMoveAccumulator HoldMove;
+  int8 HoldMoveInScript = -1; // !!! unknown until the first move
+  struct LocalState { // !!! only useful to a locally controlled pawn
+    struct TouchFingerState TouchFingerStates[ETouchIndex::MAX_TOUCHES];
+    FHitResult PickRayHitResultsTick[int(EAlkPointer::Count)];
+    int TapFingers = 0; // !!! fingers pressed when a tap was released
+    bool bTouchDirty = false;
+  };
+  TUniquePtr<LocalState> Local; // !!! deferred by OPTION_REMOTE_LITE
+  struct PickRaySchedule {
+    FVector Location = FVector::ZeroVector;
+    FVector Forward  = FVector::ZeroVector;
+    float SecondsSinceTrace = 0.f;
+    bool bTraced = false;
+  };
+  struct PickRaySchedule PickRaySchedulesTick[int(EAlkPointer::Count)];
+  struct ScriptTickSubscription {
+    int EveryFrames = 0;            // !!! 0 when not subscribed by frames
+    float EverySeconds = 0.f;       // !!! 0 when not subscribed by seconds
+    int PendingFrames = 0;
+    float PendingSeconds = 0.f;
+  };
+  struct ScriptTickSubscription ScriptTick;
+  struct ScriptCallSites { // !!! resolved once at init, reused per call
+    alkchar::ScriptCallSite TickSubscription;
+    alkchar::ScriptCallSite PickRayTargetSubscription;
+    alkchar::ScriptCallSite InputSetup;
+    alkchar::ScriptCallSite Tick;
+    alkchar::ScriptCallSite PickRayTarget;
+    alkchar::ScriptCallSite::Arg & TickDelta;
+    alkchar::ScriptCallSite::Arg & PickRayTargetActor;
+    alkchar::ScriptCallSite::Arg & PickRayTargetComponent;
+
+    ScriptCallSites(AAlkCharacter & face)
+      : TickSubscription("alkchar-tick-subscription", makeAboaUeDataDict({
+          {"uobject",   makeAboaUeDataUobjectRef(face)}}))
+      , PickRayTargetSubscription("alkchar-pick-ray-target-subscription",
+          makeAboaUeDataDict({
+          {"uobject",   makeAboaUeDataUobjectRef(face)}}))
+      , InputSetup("alkchar-input-setup", makeAboaUeDataDict({
+          {"uobject",   makeAboaUeDataUobjectRef(face)}}))
+      , Tick("alkchar-tick", makeAboaUeDataDict({
+          {"uobject",   makeAboaUeDataUobjectRef(face)},
+          {"delta",     makeAboaUeDataFloat(0.f)}}))
+      , PickRayTarget("alkchar-pick-ray-target", makeAboaUeDataDict({
+          {"actor",     makeAboaUeDataUobjectPtr((AActor const *)nullptr)},
+          {"component", makeAboaUeDataUobjectPtr(
+            (UPrimitiveComponent const *)nullptr)},
+          {"uobject",   makeAboaUeDataUobjectRef(face)}}))
+      , TickDelta(Tick.Slot("delta"))
+      , PickRayTargetActor(PickRayTarget.Slot("actor"))
+      , PickRayTargetComponent(PickRayTarget.Slot("component"))
+    {}
+  };
+  TUniquePtr<ScriptCallSites> ScriptCalls;
+  struct InputReplay { // !!! stands in for the world and viewport
+    bool bActive = false;
+    FVector2D MousePosition = FVector2D::ZeroVector;
+    pure::ViewportMetrics Viewport;
+    float DeltaSeconds = 0.f;
+    float RealTimeSeconds = 0.f;
+  };
+  struct InputReplay Replay;
+  TUniquePtr<alkinput::Recording> Recording;
+  uint32 RecordingFrame = 0;
+  enum SnapMoveDirection : int32 {
+    SnapMoveForward, SnapMoveBackward, SnapMoveLeft, SnapMoveRight,
+    SnapMoveDirections
+  };
+  struct SnapMoveCandidate {
+    FVector From = FVector::ZeroVector; // !!! pawn pose when validated
+    float FromYaw = 0.f;
+    FVector Offset = FVector::ZeroVector; // !!! destination in that pose
+    bool bValid = false;
+    bool bSwept = false; // !!! From and FromYaw hold, even if blocked
+  };
+  struct SnapMoveCache { // !!! candidates relative to the pawn
+    float Distance = 0.f;
+    SnapMoveCandidate Candidates[SnapMoveDirections];
+    int32 Next = 0; // !!! next direction to revalidate, round robin
+    bool bFading = false;
+  };
+  struct SnapMoveCache SnapMove;
+  static constexpr float SnapMoveStillCm = 1.f; // !!! below, no resweep
+  static constexpr float SnapMoveStillDegrees = 1.f;
+
+  struct FeatureTickFunction : FTickFunction {
+    AAlkCharacterImpl * Owner = nullptr;
+    void (AAlkCharacterImpl::*Update)(float) = nullptr;
+    TCHAR const * Name = TEXT("");
+
+    virtual void ExecuteTick(
+      float DeltaTime,
+      ELevelTick TickType,
+      ENamedThreads::Type CurrentThread,
+      FGraphEventRef const & MyCompletionGraphEvent
+    ) override {
+      if (   (TickType != LEVELTICK_ViewportsOnly)
+          && Owner->face.PrimaryActorTick.IsTickFunctionEnabled())
+        (Owner->*Update)(DeltaTime); // !!! SetActorTickEnabled() governs all
+    }
+    virtual auto DiagnosticMessage() -> FString override {
+      return FString::Printf(TEXT("%s[%s]"),
+        *Owner->face.GetFullName(), Name);
+    }
+  };
+  FeatureTickFunction HMDTickFunction;
+  FeatureTickFunction InputTickFunction;
+  FeatureTickFunction ScriptTickFunction;
+  FeatureTickFunction PickRayTickFunction;
+  TWeakObjectPtr<AController> InputTickController;
+  float HMDInlineSeconds = 0.f; // !!! AlkTickFeatures() only
 
   AAlkCharacter const & face;
   AAlkCharacter & face_mut;
 
   AAlkCharacterImpl(AAlkCharacter& face)
-    : face(face), face_mut(face) {}
+    : face(face), face_mut(face) {
+    HMDPresence.SampleSeconds = 0.f;
+      // ^ !!! AlkTickHMD.TickInterval or the batched timers throttle
+    HMDPresence.OnWornChanged = [this](bool const worn) {
+      HMDState.Worn = worn;
+      ApplyHMDState();
+    };
+    InitFeatureTick(HMDTickFunction,     &AAlkCharacterImpl::UpdateHMDState,  TEXT("HMD"));
+    InitFeatureTick(InputTickFunction,   &AAlkCharacterImpl::TickInput,       TEXT("Input"));
+    InitFeatureTick(ScriptTickFunction,  &AAlkCharacterImpl::UpdateScriptTick, TEXT("Script"));
+    InitFeatureTick(PickRayTickFunction, &AAlkCharacterImpl::TickPickRay,     TEXT("PickRay"));
+  }
+
+  void InitFeatureTick(
+    FeatureTickFunction & tick,
+    void (AAlkCharacterImpl::*update)(float),
+    TCHAR const * name
+  ) {
+    tick.Owner = this;
+    tick.Update = update;
+    tick.Name = name;
+    tick.bCanEverTick = true;
+    tick.bStartWithTickEnabled = true;
+  }
+
+  void RegisterFeatureTick(
+    FeatureTickFunction & tick,
+    FAlkFeatureTick const & settings,
+    bool const bRegister
+  ) {
+    if (tick.IsTickFunctionRegistered())
+      tick.UnRegisterTickFunction();
+    if (!bRegister || !settings.bEnabled)
+      return; // !!! disabled features cost nothing per frame
+    tick.TickGroup = settings.TickGroup;
+    tick.TickInterval = settings.TickInterval;
+    tick.RegisterTickFunction(face_mut.GetLevel());
+  }
+
+  void RegisterFeatureTicks(bool const bRegister) {
+    RegisterFeatureTick(HMDTickFunction, face.AlkTickHMD,
+      bRegister && TimersSlot == INDEX_NONE); // !!! else sampled in batch
+    RegisterFeatureTick(InputTickFunction, face.AlkTickInput,
+      bRegister && Local); // !!! OPTION_REMOTE_LITE until locally possessed
+    RegisterFeatureTick(ScriptTickFunction, face.AlkTickScript, bRegister);
+    RegisterFeatureTick(PickRayTickFunction, face.AlkTickPickRay, bRegister);
+    if (!bRegister)
+      return;
+    // !!! input feeds the movement the actor tick consumes, script follows
+    if (InputTickFunction.IsTickFunctionRegistered())
+      face_mut.PrimaryActorTick.AddPrerequisite(&face_mut, InputTickFunction);
+    else
+      face_mut.PrimaryActorTick.RemovePrerequisite(&face_mut, InputTickFunction);
+    if (ScriptTickFunction.IsTickFunctionRegistered())
+      ScriptTickFunction.AddPrerequisite(&face_mut, face_mut.PrimaryActorTick);
+    LinkInputTickToController();
+  }
+
+  void LinkInputTickToController() {
+    if (auto const previous = InputTickController.Get())
+      InputTickFunction.RemovePrerequisite(
+        previous, previous->PrimaryActorTick);
+    InputTickController = nullptr;
+    auto const controller = face_mut.GetController();
+    if (!controller || !InputTickFunction.IsTickFunctionRegistered())
+      return;
+    // !!! PlayerInput dispatches this frame's callbacks in the controller
+    // !!! tick; AddPawnTickDependency only orders the actor tick after it
+    InputTickFunction.AddPrerequisite(controller, controller->PrimaryActorTick);
+    InputTickController = controller;
+  }
+
+  void TickInput(float const DeltaSeconds) {
+    RecordFrame(DeltaSeconds);
+    UpdateMouseState();
+    UpdateTouchState();
+    UpdateHoldMove();
+    if (!BatchedTimers())
+      UpdateInputState(DeltaSeconds);
+    UpdateSnapMoveCache();
+  }
+
+  void TickPickRay(float const DeltaSeconds) {
+    if (face.AlkPickRayTickEnabled)
+      UpdatePickRayTick(DeltaSeconds);
+  }
 
   ~AAlkCharacterImpl() {}
 
@@ -89,19 +333,77 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
     //face_mut.ThirdPersonMesh->SetAnimationMode(EAnimationMode::AnimationCustomMode);
     //face_mut.ThirdPersonMesh->SetSkinnedAssetAndUpdate(NULL);
     //face_mut.ThirdPersonMesh->SetVisibility(false);
-    face_mut.AlkFollowCamera    ->SetActiveFlag(false);
+    if (face_mut.AlkFollowCamera)
+      face_mut.AlkFollowCamera  ->SetActiveFlag(false);
     face_mut.VRReplicatedCamera ->SetActiveFlag(true);
     face_mut.AlkCameraActive    = face_mut.VRReplicatedCamera;
     face_mut.AlkFirstPerson     = true;
   }
 
   void EstablishThirdPerson() {
+    if (!face_mut.AlkFollowCamera)
+      return; // !!! not yet locally possessed with OPTION_REMOTE_LITE
     face_mut.VRReplicatedCamera ->SetActiveFlag(false);
     face_mut.AlkFollowCamera    ->SetActiveFlag(true);
     face_mut.AlkCameraActive    = face_mut.AlkFollowCamera;
     face_mut.AlkFirstPerson     = false;
   }
 
+  void EstablishLocal() {
+    // !!! OPTION_REMOTE_LITE defers these until a local player possesses
+    if (!Local) {
+      Local = MakeUnique<LocalState>();
+      if (face.PrimaryActorTick.IsTickFunctionRegistered())
+        RegisterFeatureTicks(true); // !!! now with the input tick
+    }
+    if (!face_mut.AlkFollowBoom) {
+      face_mut.AlkFollowBoom = NewObject<USpringArmComponent>(
+        &face_mut, TEXT("AlkFollowBoom"));
+      face_mut.AlkFollowBoom->SetupAttachment(face_mut.GetRootComponent());
+      face_mut.AlkFollowBoom->RegisterComponent();
+    }
+    if (!face_mut.AlkFollowCamera) {
+      face_mut.AlkFollowCamera = NewObject<UCameraComponent>(
+        &face_mut, TEXT("AlkFollowCamera"));
+      face_mut.AlkFollowCamera->RegisterComponent();
+      if (face.HasActorBegunPlay()) {
+        EstablishFollowCamera();
+        EstablishThirdPerson(); // TODO: ### FORCED FOR NOW
+      }
+    }
+    if (face.HasAnyOptions(AAlkCharacter::OPTION_CAN_SHOOT)) {
+      auto const acquireShootNode = [this](
+        TObjectPtr<UGripMotionControllerComponent> & node,
+        TCHAR const * const name,
+        USceneComponent * const parent
+      ) {
+        if (node)
+          return;
+        node = NewObject<UGripMotionControllerComponent>(&face_mut, name);
+        if (parent)
+          node->SetupAttachment(parent);
+        node->RegisterComponent();
+      };
+      acquireShootNode(face_mut.AlkNodeShootMotionControllerL,
+        TEXT("AlkNodeShootMotionControllerL"), face_mut.LeftMotionController);
+      acquireShootNode(face_mut.AlkNodeShootMotionControllerR,
+        TEXT("AlkNodeShootMotionControllerR"), face_mut.RightMotionController);
+    }
+  }
+
+  void EstablishFollowCamera() {
+    if (!face_mut.AlkFollowBoom || !face_mut.AlkFollowCamera)
+      return;
+    face_mut.AlkFollowBoom->SetRelativeLocation(
+      FVector(.0, .0, 1.5*face.GetCapsuleComponent()->GetScaledCapsuleHalfHeight()));
+    face_mut.AlkFollowCamera->SetRelativeLocation(
+      FVector(.0, 25.0, .0)); // TODO: ### HARDCODED OFFSET TO RIGHT SHOULDER
+    face_mut.AlkFollowCamera->AttachToComponent(
+      face_mut.AlkFollowBoom,
+      FAttachmentTransformRules::KeepRelativeTransform,
+      USpringArmComponent::SocketName);
+  }
+
   void EstablishMoving() {
     if (!bTurningBodyNotCamera) {
          bTurningBodyNotCamera = true;
@@ -139,34 +441,20 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
   void ApplyHMDState() {
     if (face_mut.VRReplicatedCamera)
         face_mut.VRReplicatedCamera->bUsePawnControlRotation = !HMDState.Worn;
-    if (face.AlkTracing)
-      UKismetSystemLibrary::PrintString(&face_mut,
-        HMDState.Worn ? FString(TEXT("HMD worn"))
-                      : FString(TEXT("HMD NOT worn")));
+    if (HMDState.Worn)
+      ALK_TRACE(face, CategoryHMD, HMDWorn);
+    else
+      ALK_TRACE(face, CategoryHMD, HMDNotWorn);
   }
 
   void UpdateHMDState(float const DeltaSeconds) {
-    HMDState.UpdateDeltaSeconds += DeltaSeconds;
-    if (   (HMDState.UpdateTotalSeconds > 0.f)
-        && (HMDState.UpdateDeltaSeconds < HMDUpdateFrequencySeconds))
-      return;
-    FRotator orientation;
-    FVector position;
-    UHeadMountedDisplayFunctionLibrary::GetOrientationAndPosition(
-      orientation, position);
-    bool worn = (HMDState.Orientation != orientation)
-                || (HMDState.Position != position);
-    if (worn) {
-      HMDState.Orientation = orientation;
-      HMDState.Position = position;
-    }
-    if (   (HMDState.UpdateTotalSeconds == 0.f)
-        || (HMDState.Worn != worn)) {
-      HMDState.Worn = worn;
-      ApplyHMDState();
-    }
-    HMDState.UpdateTotalSeconds += HMDState.UpdateDeltaSeconds;
-    HMDState.UpdateDeltaSeconds = 0.f;
+    ALK_STAT_SCOPE(UpdateHMDState);
+    HMDPresence.Detector.NoiseFloorCm = face.AlkHMDNoiseFloorCm;
+    HMDPresence.Detector.NoiseFloorDegrees = face.AlkHMDNoiseFloorDegrees;
+    HMDPresence.Detector.UnwornAfterStillSeconds =
+      face.AlkHMDUnwornAfterStillSeconds;
+    HMDPresence.Update(DeltaSeconds);
+      // ^ !!! samples only until XR notifications arrive
 #if 0 // TODO: @@@ SteamVR DOES NOT PROPERLY INDICATE WornState
     static auto const prevWornState = EHMDWornState::Unknown;
     auto const nextWornState = UHeadMountedDisplayFunctionLibrary::GetHMDWornState();
@@ -181,6 +469,7 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
   }
 
   void UpdateInputState(float const DeltaSeconds) {
+    ALK_STAT_SCOPE(UpdateInputState);
     if (FireMeasuring) {
       FireSeconds += DeltaSeconds;
       if (FireSeconds >= face.AlkInputFireRapidThresholdSeconds)
@@ -188,41 +477,425 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
     }
     if (HoldMeasuring) {
       HoldSeconds += DeltaSeconds;
-      if (!face.AlkHolding && HoldSeconds >= face.AlkInputHoldThresholdSeconds) {
-        EnterHolding(pure::VectorFromVector2D( // TODO: ### ASSUMING MOUSE
-          UpdateViewportMousePositionReturnDelta()));
+      if (!face.AlkHolding && HoldSeconds >= face.AlkInputHoldThresholdSeconds)
+        EnterHoldingAfterThreshold();
+    }
+  }
+
+  void EnterHoldingAfterThreshold() {
+    EnterHolding(pure::VectorFromVector2D( // TODO: ### ASSUMING MOUSE
+      UpdateViewportMousePositionReturnDelta()));
+  }
+
+  auto BatchedTimers() const -> UAlkCharacterTimers * {
+    return TimersSlot != INDEX_NONE ? Timers.Get() : nullptr;
+  }
+
+  void StartBatchedTimers() {
+    auto const world = face.GetWorld();
+    auto const timers = world ? world->GetSubsystem<UAlkCharacterTimers>() : nullptr;
+    if (!timers)
+      return;
+    Timers = timers;
+    TimersSlot = timers->Register(face_mut, face.AlkTickHMD.bEnabled
+      ? face.AlkTickHMD.TickInterval : MAX_flt);
+    if (FireMeasuring)
+      timers->RestartFire(TimersSlot, face.AlkInputFireRapidThresholdSeconds);
+    if (HoldMeasuring && !face.AlkHolding)
+      timers->RestartHold(TimersSlot, face.AlkInputHoldThresholdSeconds);
+    if (face.PrimaryActorTick.IsTickFunctionRegistered())
+      RegisterFeatureTicks(true); // !!! drops the per-actor HMD tick
+  }
+
+  void StopBatchedTimers() {
+    if (auto const timers = BatchedTimers())
+      timers->Unregister(TimersSlot);
+    Timers = nullptr;
+    TimersSlot = INDEX_NONE;
+  }
+
+  void StartIntentValidation() {
+    auto const world = face.GetWorld();
+    auto const validator = world
+      ? world->GetSubsystem<UAlkIntentValidator>()
+      : nullptr;
+    if (!validator)
+      return;
+    IntentValidator = validator;
+    IntentValidatorSlot = validator->Register(face_mut);
+  }
+
+  void StopIntentValidation() {
+    auto const validator = IntentValidator.Get();
+    if (validator && (IntentValidatorSlot != INDEX_NONE))
+      validator->Unregister(IntentValidatorSlot);
+    IntentValidator = nullptr;
+    IntentValidatorSlot = INDEX_NONE;
+  }
+
+  auto SendsIntents() const -> bool {
+    return face.bAlkReplicatedIntents
+      && !face.HasAuthority() && face.IsLocallyControlled();
+  }
+
+  auto ReadServerSeconds() const -> double {
+    auto const world = face.GetWorld();
+    if (!world)
+      return 0.;
+    auto const state = world->GetGameState();
+    return state
+      ? state->GetServerWorldTimeSeconds() // !!! as the server rewinds to
+      : world->GetTimeSeconds();
+  }
+
+  void QueueIntent(
+    EAlkIntentKind const kind,
+    EAlkPointer const pointer,
+    FVector const & origin,
+    FVector const & direction
+  ) {
+    auto & intent = PendingIntents.AddDefaulted_GetRef();
+    intent.Kind = kind;
+    intent.Pointer = uint8(pointer);
+    intent.Origin = origin;
+    intent.Direction = direction.GetSafeNormal();
+    intent.ServerSeconds = ReadServerSeconds();
+    if (PendingIntents.Num() >= UAlkIntentValidator::BatchMax)
+      FlushIntents(); // !!! rapid fire outpacing AlkIntentBatchSeconds
+  }
+
+  void FlushIntents() {
+    ALK_STAT_COUNT(IntentsSent, PendingIntents.Num());
+    ALK_STAT_COUNT(IntentBatches, 1);
+    ALK_TRACE(face, CategoryNet, IntentBatchSent, PendingIntents.Num());
+    face_mut.ServerAlkIntents(PendingIntents);
+    PendingIntents.Reset();
+    IntentsPendingSeconds = 0.f;
+  }
+
+  void UpdateIntents(float const DeltaSeconds) {
+    if (PendingIntents.Num() == 0)
+      return;
+    IntentsPendingSeconds += DeltaSeconds; // !!! since the oldest pending
+    if (IntentsPendingSeconds >= face.AlkIntentBatchSeconds)
+      FlushIntents();
+  }
+
+  void BroadcastPointerTarget(
+    EAlkPointer const pointer,
+    AActor * const actor,
+    UPrimitiveComponent * const component
+  ) {
+    face_mut.AlkOnPickRayPointerTargetChangedNative.Broadcast(
+      face_mut, pointer, actor, component);
+    face_mut.AlkOnPickRayPointerTargetChanged.Broadcast(
+      &face_mut, pointer, actor, component);
+  }
+
+  void SetPickTarget(EAlkPointer const pointer, FHitResult const & hitres) {
+    if (!face.AlkPickTargets.IsValidIndex(int(pointer)))
+      return;
+    auto & target = face_mut.AlkPickTargets[int(pointer)];
+    auto const actor = hitres.HitObjectHandle.FetchActor();
+    auto const component = hitres.Component.Get();
+    if ((target.Actor == actor) && (target.Component == component))
+      return;
+    target.Actor = actor;
+    target.Component = component;
+    if (!face.IsLocallyControlled())
+      BroadcastPointerTarget(pointer, actor, component);
+        // ^ !!! as AlkOnRepPickTargets() does on the other clients
+  }
+
+  void SpawnProjectile(FVector const & location, FRotator const & rotation) {
+    auto const world = face.GetWorld();
+    if (!world || !face.AlkProjectileClass)
+      return;
+    auto const pool = face.bAlkProjectilePooling
+      ? world->GetSubsystem<UAlkProjectilePool>()
+      : nullptr;
+    if (   !pool
+        || !pool->Acquire(face.AlkProjectileClass, location, rotation,
+                          &face_mut, &face_mut)) { // !!! falls back when not poolable
+      FActorSpawnParameters ActorSpawnParams;
+      ActorSpawnParams.SpawnCollisionHandlingOverride =
+        ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButDontSpawnIfColliding;
+      if (world->SpawnActor<AActor>(face.AlkProjectileClass, location, rotation, ActorSpawnParams))
+        ALK_STAT_COUNT(ProjectilesSpawned, 1);
+    }
+  }
+
+  void SubscribeScriptTick(FString const & spec) {
+    // !!! spec is "none", "frames N" (every N frames) or "seconds T"
+    ScriptTick = ScriptTickSubscription();
+    FString mode, rate;
+    if (!spec.TrimStartAndEnd().Split(TEXT(" "), &mode, &rate))
+      mode = spec.TrimStartAndEnd();
+    if (mode == TEXT("frames"))
+      ScriptTick.EveryFrames = FMath::Max(1, FCString::Atoi(*rate));
+    else if (mode == TEXT("seconds"))
+      ScriptTick.EverySeconds = FMath::Max(0.f, FCString::Atof(*rate));
+    if (ScriptTick.EveryFrames == 0 && ScriptTick.EverySeconds == 0.f
+        && mode == TEXT("seconds"))
+      ScriptTick.EveryFrames = 1; // !!! "seconds 0" means every frame
+  }
+
+  auto EstablishScriptCalls() -> ScriptCallSites & {
+    if (!ScriptCalls)
+      ScriptCalls = MakeUnique<ScriptCallSites>(face_mut);
+    return *ScriptCalls;
+  }
+
+  auto IsScriptTickSubscribed() const -> bool {
+    return ScriptTick.EveryFrames > 0 || ScriptTick.EverySeconds > 0.f;
+  }
+
+  void UpdateScriptTick(float const DeltaSeconds) {
+    if (!IsScriptTickSubscribed())
+      return; // !!! skip the script bridge entirely
+    ScriptTick.PendingSeconds += DeltaSeconds;
+    if (ScriptTick.EveryFrames > 0) {
+      if (++ScriptTick.PendingFrames < ScriptTick.EveryFrames)
+        return;
+    } else if (ScriptTick.PendingSeconds < ScriptTick.EverySeconds)
+      return;
+    auto & calls = EstablishScriptCalls();
+    calls.TickDelta = makeAboaUeDataFloat(ScriptTick.PendingSeconds);
+      // !!! ^ delta covers every frame since the previous dispatch
+    ScriptTick.PendingFrames = 0;
+    ScriptTick.PendingSeconds = 0.f;
+    calls.Tick.Call();
+  }
+
+  static constexpr auto PointerBit(EAlkPointer const pointer) -> int32 {
+    return 1 << int(pointer);
+  }
+
+  auto ReadPointerRay(
+    EAlkPointer const pointer,
+    FVector & location,
+    FVector & forward
+  ) const -> bool {
+    USceneComponent const * node = nullptr;
+    switch (pointer) {
+      case EAlkPointer::Camera:
+        node = face.AlkCameraActive;
+        break;
+      case EAlkPointer::Left:
+        if (face.bAlkUsingMotionControllers)
+          node = face.LeftMotionController;
+        break;
+      case EAlkPointer::Right:
+        if (face.bAlkUsingMotionControllers)
+          node = face.RightMotionController;
+        break;
+      default:
+        break;
+    }
+    if (!node)
+      return false; // !!! not locally possessed with OPTION_REMOTE_LITE
+    location = node->GetComponentLocation();
+    forward  = node->GetForwardVector();
+    return true;
+  }
+
+  // !!! one pass over every pointer of the mask sharing the world lookup,
+  // !!! the registry or the query params, returns the mask of hits;
+  // !!! the camera always goes through AlkPickRayCameraHit
+  auto PickPointers(
+    int32 const pointers,
+    FHitResult * const outHits // !!! EAlkPointer::Count of them
+  ) -> int32 {
+    auto const world = face.GetWorld();
+    if (!world)
+      return 0;
+    auto const registry = face.bAlkPickRayUseRegistry
+      ? world->GetSubsystem<UAlkPickableRegistry>()
+      : nullptr;
+    FCollisionQueryParams const params(
+      SCENE_QUERY_STAT(AlkPickRay), false, &face); // !!! ignore self
+    ALK_STAT_SCOPE(PickRayTrace);
+    int32 hits = 0;
+    for (int p = 0; p < int(EAlkPointer::Count); ++p) {
+      auto const pointer = EAlkPointer(p);
+      if (!(pointers & PointerBit(pointer)))
+        continue;
+      outHits[p] = FHitResult();
+      if (pointer == EAlkPointer::Camera) { // !!! the Blueprint-overridable path
+        if (face_mut.AlkPickRayCameraHit(outHits[p]))
+          hits |= PointerBit(pointer);
+        continue;
       }
+      FVector location, forward;
+      if (!ReadPointerRay(pointer, location, forward))
+        continue;
+      auto const hit = registry
+        ? registry->Pick(location, forward, face.AlkPickRange,
+            face.AlkPickConeDegrees, face.AlkPickGazeRadius, outHits[p])
+        : world->LineTraceSingleByChannel(outHits[p],
+            location, location + (forward * face.AlkPickRange),
+            ECC_Visibility, // !!! same as TraceTypeQuery1 in AlkPickRayHit
+            params);
+      if (!registry)
+        ALK_STAT_COUNT(PickRayTraces, 1);
+      if (hit)
+        hits |= PointerBit(pointer);
+    }
+    return hits;
+  }
+
+  auto SchedulePickRayTick(
+    EAlkPointer const pointer,
+    FVector const & location,
+    FVector const & forward,
+    float const DeltaSeconds
+  ) -> bool {
+    auto & sched = PickRaySchedulesTick[int(pointer)];
+    sched.SecondsSinceTrace += DeltaSeconds;
+    if (   sched.bTraced
+        && (sched.SecondsSinceTrace < face.AlkPickRayRetraceMaxSeconds)
+        && (FVector::DistSquared(location, sched.Location)
+            < FMath::Square(face.AlkPickRayRetraceMinDistance))
+        && (FVector::DotProduct(forward, sched.Forward)
+            > FMath::Cos(FMath::DegreesToRadians(
+                face.AlkPickRayRetraceMinDegrees)))) {
+      ++face_mut.AlkPickRayTickSkipCount;
+      ALK_STAT_COUNT(PickRaySkips, 1);
+      return false; // !!! view has not actually moved
+    }
+    sched.Location = location;
+    sched.Forward = forward;
+    sched.SecondsSinceTrace = 0.f;
+    sched.bTraced = true;
+    ++face_mut.AlkPickRayTickTraceCount;
+    return true;
+  }
+
+  void UpdatePickRayTick(float const DeltaSeconds) {
+    FVector locations[int(EAlkPointer::Count)];
+    FVector forwards [int(EAlkPointer::Count)];
+    int32 due = 0;
+    for (int p = 0; p < int(EAlkPointer::Count); ++p) {
+      auto const pointer = EAlkPointer(p);
+      if (   (face.AlkPickRayTickPointers & PointerBit(pointer))
+          && ReadPointerRay(pointer, locations[p], forwards[p])
+          && SchedulePickRayTick(pointer, locations[p], forwards[p],
+               DeltaSeconds))
+        due |= PointerBit(pointer);
+    }
+    if (!due)
+      return; // !!! keep the previous targets
+    auto const world = face.GetWorld();
+    auto const pickRays =
+           face.AlkPickRayTickAsync && !face.bAlkPickRayUseRegistry && world
+      ? world->GetSubsystem<UAlkPickRaySubsystem>()
+      : nullptr;
+    if (pickRays) {
+      for (int p = 0; p < int(EAlkPointer::Count); ++p)
+        if (due & PointerBit(EAlkPointer(p)))
+          pickRays->QueuePickRay(face_mut, locations[p],
+            locations[p] + (forwards[p] * face.AlkPickRange), EAlkPointer(p));
+    } else {
+      FHitResult hitresnext[int(EAlkPointer::Count)];
+      PickPointers(due, hitresnext);
+      for (int p = 0; p < int(EAlkPointer::Count); ++p)
+        if (due & PointerBit(EAlkPointer(p)))
+          face_mut.AlkPickRayApplyPointerHit(EAlkPointer(p), hitresnext[p]);
     }
   }
 
+  auto ReadViewportMousePosition() const -> FVector2D {
+    return Replay.bActive
+      ? Replay.MousePosition
+      : pure::WorldGameViewportMousePosition(face.GetWorld());
+  }
+
+  auto ReadViewportMetrics() const -> pure::ViewportMetrics const & {
+    return Replay.bActive
+      ? Replay.Viewport
+      : pure::WorldGameViewportMetrics(face.GetWorld());
+  }
+
+  auto ReadViewportSize() const -> FVector2D {
+    return ReadViewportMetrics().Size;
+  }
+
+  auto ReadRealTimeSeconds() const -> float {
+    return Replay.bActive
+      ? Replay.RealTimeSeconds
+      : pure::WorldRealTimeSeconds(face.GetWorld());
+  }
+
+  auto ReadDeltaSeconds() const -> float {
+    auto const world = face.GetWorld();
+    return Replay.bActive ? Replay.DeltaSeconds
+      : world ? world->GetDeltaSeconds() : 0.f;
+  }
+
+  void RecordInput(
+    alkinput::Kind const kind,
+    float const value = 0.f,
+    ETouchIndex::Type const finger = ETouchIndex::Touch1,
+    FVector const & location = FVector::ZeroVector
+  ) {
+    if (!Recording)
+      return;
+    alkinput::Event e;
+    e.Frame    = RecordingFrame;
+    e.Seconds  = ReadRealTimeSeconds();
+    e.Type     = kind;
+    e.Finger   = uint8(finger);
+    e.Value    = value;
+    e.DeltaSeconds = ReadDeltaSeconds();
+      // ^ !!! callbacks run before the tick that records Frame
+    e.Location = FVector2f(location.X, location.Y);
+    e.Mouse    = FVector2f(ReadViewportMousePosition());
+    Recording->Events.Add(e);
+  }
+
+  void RecordFrame(float const DeltaSeconds) {
+    if (!Recording)
+      return;
+    RecordInput(alkinput::Kind::Frame, DeltaSeconds);
+    ++RecordingFrame;
+  }
+
   void UpdateViewportState() {
-    auto const vpSize = pure::WorldGameViewportSize(face.GetWorld());
-    ViewportDivisor = (vpSize.X > vpSize.Y)
-      ?  FVector2D(vpSize.X, vpSize.X)
-      :  FVector2D(vpSize.Y, vpSize.Y);
+    // !!! the metrics are re-measured on resize, so this is a compare
+    auto const & vp = ReadViewportMetrics();
+    if (vp.Version == ViewportVersion)
+      return;
+    ViewportVersion = vp.Version;
+    auto const vpSize = vp.Size;
+    ViewportDivisor = vp.Divisor;
     ViewportDragThresholdRatio = // TODO: @@@ NOT YET USED
       FVector2D(face.AlkInputDragThresholdPixels,
                 face.AlkInputDragThresholdPixels)
       / vpSize;
-    if (face.AlkTracing)
-      UKismetSystemLibrary::PrintString(&face_mut,
-        FString::Printf(TEXT("viewport size %f x %f"), vpSize.X, vpSize.Y));
+    ALK_TRACE(face, CategoryViewport, ViewportSize, vpSize.X, vpSize.Y);
   }
 
   auto UpdateViewportMousePositionReturnDelta() -> FVector2D{
-    auto const mousePos = pure::WorldGameViewportMousePosition(face.GetWorld());
+    auto const mousePos = ReadViewportMousePosition();
     auto const deltaPos = mousePos - ViewportMousePosition;
     ViewportMousePosition = mousePos;
     return deltaPos;
   }
 
-  void UpdatePointerWorldFromViewport(FVector2D vpPos) {
-    auto const pc = face.GetLocalViewingPlayerController();
-    if (pc) {
-      FVector worldPos;
-      pc->DeprojectScreenPositionToWorld(
-        vpPos.X, vpPos.Y, worldPos, face_mut.AlkPointerWorldDirection);
+  auto ReadViewProjection() -> pure::ViewProjection const & {
+    // !!! captured once per frame however many points get deprojected
+    if (ViewProjectionFrame != GFrameCounter) {
+      ViewProjectionFrame = GFrameCounter;
+      ViewProjection = pure::ViewProjectionFromPlayerController(
+        face.GetLocalViewingPlayerController());
     }
+    return ViewProjection;
+  }
+
+  void UpdatePointerWorldFromViewport(FVector2D vpPos) {
+    FVector worldPos;
+    ReadViewProjection().Deproject(
+      vpPos, worldPos, face_mut.AlkPointerWorldDirection);
   }
 
   void UndoMouseDeltaPosition(FVector2D deltaPos) {
@@ -230,6 +903,11 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
   }
 
   void SetMousePosition(FVector2D pos) {
+    if (Replay.bActive) { // !!! the recorded warp, without a controller
+      Replay.MousePosition = pos;
+      UpdateViewportMousePositionReturnDelta();
+      return;
+    }
     auto const pc = face.GetLocalViewingPlayerController();
     if (pc) {
       pc->SetMouseLocation(pos.X, pos.Y);
@@ -244,6 +922,7 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
 
   void LeaveHolding(FVector const & ScreenCoordinates) {
     face_mut.AlkHolding = false;
+    HoldMove = HoldMoveAccumulator(); // !!! no move after the leave
     face_mut.AlkOnHoldLeave(ScreenCoordinates);
   }
 
@@ -254,21 +933,29 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
 
   void MaintainFireMeasuring() {
     FireSeconds = 0.f;
+    if (auto const timers = FireMeasuring ? BatchedTimers() : nullptr)
+      timers->RestartFire(TimersSlot, face.AlkInputFireRapidThresholdSeconds);
   }
 
   void StopFireMeasuring() {
     FireMeasuring = false;
+    if (auto const timers = BatchedTimers())
+      timers->StopFire(TimersSlot);
     FireRapidCount = 0;
   }
 
   void StartHoldMeasuring() {
     HoldMeasuring = true;
     HoldSeconds = 0.f;
+    if (auto const timers = BatchedTimers())
+      timers->RestartHold(TimersSlot, face.AlkInputHoldThresholdSeconds);
   }
 
   void StopHoldMeasuring() {
     HoldMeasuring = false;
     HoldSeconds = 0.f;
+    if (auto const timers = BatchedTimers())
+      timers->StopHold(TimersSlot);
   }
 
   void HandleFireOrHoldPressed(
@@ -305,21 +992,17 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
   }
 
   void InputFireOrHoldPressed() {
-    if (face.AlkTracing)
-      UKismetSystemLibrary::PrintString(&face_mut,
-        FString(TEXT("InputFireOrHoldPressed()")));
+    ALK_TRACE(face, CategoryInput, InputFireOrHoldPressed);
     HandleFireOrHoldPressed(pure::VectorFromVector2D(
       // TODO: @@@ ASSUMING MOUSE, BUT WHAT ABOUT MOTIONCONTROLLERS?
-      pure::WorldGameViewportMousePosition(face.GetWorld())));
+      ReadViewportMousePosition()));
   }
 
   void InputFireOrHoldReleased() {
-    if (face.AlkTracing)
-      UKismetSystemLibrary::PrintString(&face_mut,
-        FString(TEXT("InputFireOrHoldReleased()")));
+    ALK_TRACE(face, CategoryInput, InputFireOrHoldReleased);
     HandleFireOrHoldReleased(pure::VectorFromVector2D(
       // TODO: @@@ ASSUMING MOUSE, BUT WHAT ABOUT MOTIONCONTROLLERS?
-      pure::WorldGameViewportMousePosition(face.GetWorld())));
+      ReadViewportMousePosition()));
   }
 
   void InputRecenterXR() {
@@ -365,24 +1048,20 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
   }
 
   void InputTurnRate(float const Rate) {
-    auto const world = face.GetWorld();
-    if (world && Rate != 0.f) face_mut.AddControllerYawInput(
-      Rate * face.AlkTurnRateDegPerSec * world->GetDeltaSeconds());
+    if (Rate != 0.f) face_mut.AddControllerYawInput(
+      Rate * face.AlkTurnRateDegPerSec * ReadDeltaSeconds());
   }
 
   void InputLookRate(float const Rate) {
-    auto const world = face.GetWorld();
-    if (world && Rate != 0.f) face_mut.AddControllerPitchInput(
-      Rate * face.AlkLookRateDegPerSec * world->GetDeltaSeconds());
+    if (Rate != 0.f) face_mut.AddControllerPitchInput(
+      Rate * face.AlkLookRateDegPerSec * ReadDeltaSeconds());
   }
 
   void InputMouseMovingDisable() {
     EstablishStoppingForward();
     EstablishStoppingRight();
     bMouseMovingEnabled = false;
-    if (face.AlkTracing)
-      UKismetSystemLibrary::PrintString(&face_mut,
-        FString(TEXT("InputMouseMovingDisable()")));
+    ALK_TRACE(face, CategoryInput, InputMouseMovingDisable);
   }
 
   void InputMouseMovingEnable() {
@@ -392,16 +1071,12 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
     // !!! update whenever enabled in case the viewport changed
     UpdateViewportState();
     UpdateViewportMousePositionReturnDelta();
-    if (face.AlkTracing)
-      UKismetSystemLibrary::PrintString(&face_mut,
-        FString(TEXT("InputMouseMovingEnable()")));
+    ALK_TRACE(face, CategoryInput, InputMouseMovingEnable);
   }
 
   void InputMouseTurningDisable() {
     bMouseTurningEnabled = false;
-    if (face.AlkTracing)
-      UKismetSystemLibrary::PrintString(&face_mut,
-        FString(TEXT("InputMouseTurningDisable()")));
+    ALK_TRACE(face, CategoryInput, InputMouseTurningDisable);
   }
 
   void InputMouseTurningEnable() {
@@ -409,19 +1084,27 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
     // !!! update whenever enabled in case the viewport changed
     UpdateViewportState();
     UpdateViewportMousePositionReturnDelta();
-    if (face.AlkTracing)
-      UKismetSystemLibrary::PrintString(&face_mut,
-        FString(TEXT("InputMouseTurningEnable()")));
+    ALK_TRACE(face, CategoryInput, InputMouseTurningEnable);
   }
 
   void InputMouseAxis(float const Value) {
-    if (Value == 0.f)
-      return;
+    ALK_STAT_SCOPE(InputMouseAxis);
     // !!! we are not using the passed in Value because it is inconsistent
     // !!! due to project settings: input axis mapping scale, FOVScaling
+    // !!! so both AlkMouseX and AlkMouseY only mark for UpdateMouseState()
+    if (Value != 0.f)
+      bMouseDirty = true;
+  }
+
+  void UpdateMouseState() {
+    if (!bMouseDirty)
+      return;
+    ALK_STAT_SCOPE(UpdateMouseState);
+    bMouseDirty = false;
+    // !!! once per frame: a single read, warp and deprojection
     auto const deltaPos = UpdateViewportMousePositionReturnDelta();
     if (face.AlkHolding)
-      face_mut.AlkOnHoldMove(pure::VectorFromVector2D(deltaPos));
+      AccumulateHoldMove(deltaPos, ViewportMousePosition);
     if (HoldMeasuring)
       StopHoldMeasuring();
     if (bMouseMovingEnabled) {
@@ -433,24 +1116,153 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
       DragTurnByViewportDelta(deltaPos);
       UndoMouseDeltaPosition(deltaPos);
     }
-    if (pure::WorldGameViewportIsMouseOverClient(face.GetWorld()))
+    if (ReadViewportMetrics().bMouseOverClient)
       UpdatePointerWorldFromViewport(ViewportMousePosition);
   }
 
   void InputSnapMoveBackward() {
-    // TODO: ### IMPLEMENT
+    InputSnapMove(SnapMoveBackward);
   }
 
   void InputSnapMoveForward() {
-    // TODO: ### IMPLEMENT
+    InputSnapMove(SnapMoveForward);
   }
 
   void InputSnapMoveLeft() {
-    // TODO: ### IMPLEMENT
+    InputSnapMove(SnapMoveLeft);
   }
 
   void InputSnapMoveRight() {
-    // TODO: ### IMPLEMENT
+    InputSnapMove(SnapMoveRight);
+  }
+
+  void InputSnapMove(SnapMoveDirection const direction) {
+    // !!! only ever uses a destination validated on an earlier frame
+    FVector destination;
+    if (SnapMove.bFading || !SnapMoveDestination(direction, destination)) {
+      ALK_TRACE(face, CategoryInput, SnapMoveRejected, float(direction));
+      return;
+    }
+    ALK_TRACE(face, CategoryInput, SnapMove, float(direction),
+      destination.X, destination.Y, destination.Z);
+    auto const world = face.GetWorld();
+    auto const pc = Cast<APlayerController>(face.GetController());
+    auto const camera = pc ? pc->PlayerCameraManager.Get() : nullptr;
+    auto const fade = face.AlkSnapMoveFadeSeconds;
+    if (fade <= 0.f || !world || !camera) {
+      CommitSnapMove(direction, destination);
+      return;
+    }
+    SnapMove.bFading = true;
+    camera->StartCameraFade(0.f, 1.f, fade, FLinearColor::Black, false, true);
+    FTimerHandle handle;
+    world->GetTimerManager().SetTimer(handle,
+      FTimerDelegate::CreateWeakLambda(&face_mut,
+          [this, direction, destination, fade]() {
+        SnapMove.bFading = false;
+        CommitSnapMove(direction, destination);
+        auto const pc = Cast<APlayerController>(face.GetController());
+        if (pc && pc->PlayerCameraManager)
+          pc->PlayerCameraManager->StartCameraFade(
+            1.f, 0.f, fade, FLinearColor::Black, false, false);
+      }),
+      fade, false);
+  }
+
+  void CommitSnapMove(
+    SnapMoveDirection const direction,
+    FVector const & destination
+  ) {
+    // !!! the destination may be frames old by now, so let TeleportTo
+    // !!! check encroachment and nudge out of anything that moved in
+    if (!face_mut.TeleportTo(destination, face.GetActorRotation()))
+      ALK_TRACE(face, CategoryInput, SnapMoveRejected, float(direction));
+  }
+
+  auto SnapMoveDestination(
+    SnapMoveDirection const direction,
+    FVector & destination
+  ) const -> bool {
+    auto const & candidate = SnapMove.Candidates[direction];
+    if (!candidate.bValid)
+      return false;
+    auto const from = face.GetActorLocation();
+    auto const yaw = face.GetVRForwardVector().Rotation().Yaw;
+    if (   !FVector::PointsAreNear(from, candidate.From,
+              face.AlkSnapMoveToleranceCm)
+        || FMath::Abs(FMath::FindDeltaAngleDegrees(yaw, candidate.FromYaw))
+           > face.AlkSnapMoveToleranceDegrees)
+      return false; // !!! drifted too far for the sweep to still hold
+    // !!! re-expressed from where the pawn stands and faces now
+    destination = from + FRotator(0.f, yaw, 0.f).RotateVector(candidate.Offset);
+    return true;
+  }
+
+  void UpdateSnapMoveCache() {
+    if (face.AlkSnapMoveDistance <= 0.f || SnapMove.bFading)
+      return;
+    if (SnapMove.Distance != face.AlkSnapMoveDistance) {
+      SnapMove.Distance = face.AlkSnapMoveDistance;
+      for (auto & candidate : SnapMove.Candidates)
+        candidate.bValid = candidate.bSwept = false;
+    }
+    // !!! one direction per frame, each keeps its last result meanwhile;
+    // !!! a pawn standing still sweeps nothing, what moves into a valid
+    // !!! destination since is caught by TeleportTo in CommitSnapMove
+    auto const from = face.GetActorLocation();
+    auto const yaw = face.GetVRForwardVector().Rotation().Yaw;
+    for (auto i = 0; i < SnapMoveDirections; ++i) {
+      auto const direction = SnapMoveDirection(SnapMove.Next);
+      SnapMove.Next = (SnapMove.Next + 1) % SnapMoveDirections;
+      auto const & candidate = SnapMove.Candidates[direction];
+      if (   !candidate.bSwept
+          || !FVector::PointsAreNear(from, candidate.From, SnapMoveStillCm)
+          || FMath::Abs(FMath::FindDeltaAngleDegrees(yaw, candidate.FromYaw))
+             > SnapMoveStillDegrees) {
+        ValidateSnapMove(direction);
+        return;
+      }
+    }
+  }
+
+  void ValidateSnapMove(SnapMoveDirection const direction) {
+    auto const world = face.GetWorld();
+    auto const capsule = face.GetCapsuleComponent();
+    if (!world || !capsule)
+      return;
+    auto & candidate = SnapMove.Candidates[direction];
+    auto const yaw = face.GetVRForwardVector().Rotation().Yaw;
+    auto const forward = face.GetVRForwardVector().GetSafeNormal2D();
+    auto const right = face.GetVRRightVector().GetSafeNormal2D();
+    FVector const offsets[SnapMoveDirections] = {
+      forward, -forward, -right, right };
+    auto const start = face.GetActorLocation();
+    candidate.From = start;
+    candidate.FromYaw = yaw;
+    candidate.bValid = false;
+    candidate.bSwept = true;
+    auto const end = start + offsets[direction] * SnapMove.Distance;
+    FCollisionQueryParams params(
+      SCENE_QUERY_STAT(AlkSnapMove), false, &face); // !!! ignore self
+    FHitResult hit;
+    if (world->SweepSingleByChannel(hit, start, end, FQuat::Identity,
+          capsule->GetCollisionObjectType(), capsule->GetCollisionShape(),
+          params))
+      return; // !!! blocked, the step would pass through geometry
+    auto destination = end;
+    auto const nav = FNavigationSystem::GetCurrent<UNavigationSystemV1>(world);
+    if (nav) { // !!! levels without navigation trust the sweep alone
+      auto const radius = capsule->GetScaledCapsuleRadius();
+      auto const halfHeight = capsule->GetScaledCapsuleHalfHeight();
+      FNavLocation navLocation;
+      if (!nav->ProjectPointToNavigation(end, navLocation,
+            FVector(radius, radius, halfHeight * 2.f)))
+        return;
+      destination = navLocation.Location + FVector(0.f, 0.f, halfHeight);
+    }
+    candidate.Offset =
+      FRotator(0.f, yaw, 0.f).UnrotateVector(destination - start);
+    candidate.bValid = true;
   }
 
   void InputSnapTurnBack() {
@@ -482,55 +1294,245 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
     ETouchIndex::Type const FingerIndex,
     FVector const Location
   ) {
-    if (FingerIndex > ETouchIndex::MAX_TOUCHES)
+    if (FingerIndex >= ETouchIndex::MAX_TOUCHES)
       return; // TODO: @@@ LOG FAILURE
-    FVector const locDelta = Location
-      - TouchFingerStates[FingerIndex].Location;
-    TouchFingerStates[FingerIndex].Location = Location;
-    if (locDelta.X == 0.f && locDelta.Y == 0.f)
+    // !!! only gathered here, classified once per frame in UpdateTouchState()
+    auto & finger = Local->TouchFingerStates[FingerIndex];
+    if (finger.Location.X == Location.X && finger.Location.Y == Location.Y)
       return;
-    if (FingerIndex == FingerIndexFire) {
-      if (face.AlkHolding)
-        face_mut.AlkOnHoldMove(Location);
-      else if (HoldMeasuring)
-        StopHoldMeasuring();
-      UpdatePointerWorldFromViewport(
-        pure::Vector2DFromVector(Location));
+    finger.Location = Location;
+    Local->bTouchDirty = true;
+  }
+
+  struct TouchGestureFrame {
+    TouchFingerState * Pressed[ETouchIndex::MAX_TOUCHES];
+    int Fingers = 0;
+    uint32 Touches = 0; // !!! bit per pressed ETouchIndex
+    FVector2D CentroidDelta = FVector2D::ZeroVector;
+    float Pinch = 0.f;
+    float Rotate = 0.f;
+  };
+
+  void UpdateTouchState() {
+    if (!Local)
+      return;
+    TouchGestureFrame frame;
+    for (auto & finger : Local->TouchFingerStates)
+      if (finger.bPressed) {
+        frame.Touches |= 1u << (&finger - Local->TouchFingerStates);
+        frame.Pressed[frame.Fingers++] = &finger;
+      }
+    if (Local->TapFingers > 0) {
+      RecognizeTouchGesture(EAlkTouchGesture::Tap, Local->TapFingers,
+        frame.Touches, FVector2D::ZeroVector);
+      Local->TapFingers = 0;
     }
-    if (!TouchFingerStates[FingerIndex].bDragged)
-      // !!! update whenever dragging starts in case the viewport changed
-      UpdateViewportState();
+    if (frame.Fingers == 0)
+      return;
+    ALK_STAT_SCOPE(UpdateTouchState);
+    auto const now = ReadRealTimeSeconds();
+    for (auto i = 0; i < frame.Fingers; ++i) {
+      auto & finger = *frame.Pressed[i];
+      if (   !finger.bDragged && !finger.bHoldRecognized
+          && (now - finger.PressedRealTimeSeconds)
+             >= face.AlkInputHoldThresholdSeconds) {
+        finger.bHoldRecognized = true;
+        RecognizeTouchGesture(EAlkTouchGesture::Hold, frame.Fingers,
+          frame.Touches, pure::Vector2DFromVector(finger.Location));
+      }
+    }
+    if (!Local->bTouchDirty)
+      return;
+    Local->bTouchDirty = false;
+    UpdateTouchFireFinger();
+    for (auto i = 0; i < frame.Fingers; ++i) {
+      auto & finger = *frame.Pressed[i];
+      auto const delta = finger.Location - finger.FrameLocation;
+      if (delta.X != 0.f || delta.Y != 0.f) {
+        if (!finger.bDragged) {
+          // !!! update whenever dragging starts in case the viewport changed
+          UpdateViewportState();
+          finger.bDragged = true;
+        }
+      }
+      frame.CentroidDelta += pure::Vector2DFromVector(delta) / frame.Fingers;
+    }
+    if (frame.Fingers >= 2) {
+      auto const & a = *frame.Pressed[0];
+      auto const & b = *frame.Pressed[1];
+      auto const spanPrev = pure::Vector2DFromVector(b.FrameLocation - a.FrameLocation);
+      auto const spanNext = pure::Vector2DFromVector(b.Location - a.Location);
+      frame.Pinch = spanNext.Size() - spanPrev.Size();
+      if (!spanPrev.IsNearlyZero() && !spanNext.IsNearlyZero())
+        frame.Rotate = FMath::RadiansToDegrees(FMath::FindDeltaAngleRadians(
+          FMath::Atan2(spanPrev.Y, spanPrev.X),
+          FMath::Atan2(spanNext.Y, spanNext.X)));
+    }
+    for (auto const & binding : face.AlkTouchGestures)
+      if (TouchGestureBindingMatches(binding, frame.Fingers, frame.Touches))
+        ApplyTouchGestureBinding(binding, frame);
+    for (auto i = 0; i < frame.Fingers; ++i) {
+      auto & finger = *frame.Pressed[i];
+      finger.FrameLocation = finger.Location;
+    }
+  }
+
+  void AccumulateHoldMove(FVector2D const & delta, FVector2D const & position) {
+    // !!! mouse and touch deltas summed in one space, as the drags use
+    if (ViewportDivisor.X > 0.f && ViewportDivisor.Y > 0.f)
+      HoldMove.Delta += delta / ViewportDivisor;
+    HoldMove.Position = position;
+    HoldMove.bPending = true;
+  }
+
+  void UpdateHoldMove() {
+    if (!HoldMove.bPending)
+      return;
+    auto const delta = pure::VectorFromVector2D(HoldMove.Delta);
+    auto const position = pure::VectorFromVector2D(HoldMove.Position);
+    HoldMove = HoldMoveAccumulator();
+    if (!face.AlkHolding)
+      return;
+    face_mut.AlkOnHoldMoveNative.Broadcast(face_mut, position, delta);
+    if (HoldMoveInScript < 0)
+      HoldMoveInScript = face.IsFunctionImplementedInScript(
+        GET_FUNCTION_NAME_CHECKED(AAlkCharacter, AlkOnHoldMove)) ? 1 : 0;
+    if (HoldMoveInScript)
+      face_mut.AlkOnHoldMove(position, delta);
     else
-      TouchFingerStates[FingerIndex].bDragged = true;
-    // TODO: ### GENERALIZE FINGER EXCLUSION LOGIC BECAUSE WE
-    //       ### RECEIVE SEPARATE CALLS FOR ALL FINGERS PRESSED
-    if (FingerIndex == FingerIndexMove) { // TODO: ### assuming Touch2
-      DragMoveByViewportDelta(pure::Vector2DFromVector(locDelta));
+      face_mut.AlkOnHoldMove_Implementation(position, delta);
+        // ^ !!! no Blueprint override, skip ProcessEvent and the VM
+  }
+
+  void UpdateTouchFireFinger() {
+    auto const & finger = Local->TouchFingerStates[FingerIndexFire];
+    if (   !finger.bPressed
+        || (   finger.Location.X == finger.FrameLocation.X
+            && finger.Location.Y == finger.FrameLocation.Y))
+      return;
+    if (face.AlkHolding)
+      AccumulateHoldMove(
+        pure::Vector2DFromVector(finger.Location - finger.FrameLocation),
+        pure::Vector2DFromVector(finger.Location));
+    else if (HoldMeasuring)
+      StopHoldMeasuring();
+    UpdatePointerWorldFromViewport(
+      pure::Vector2DFromVector(finger.Location));
+  }
+
+  static auto TouchGestureBindingMatches(
+    FAlkTouchGestureBinding const & binding,
+    int const fingers,
+    uint32 const touches
+  ) -> bool {
+    return (binding.Fingers == 0 || binding.Fingers == fingers)
+      && (touches & uint32(binding.RequiredTouches))
+         == uint32(binding.RequiredTouches)
+      && !(touches & uint32(binding.ExcludedTouches));
+  }
+
+  void ApplyTouchGestureBinding(
+    FAlkTouchGestureBinding const & binding,
+    TouchGestureFrame const & frame
+  ) {
+    FVector2D value = FVector2D::ZeroVector;
+    switch (binding.Gesture) {
+      case EAlkTouchGesture::Pan:
+        if (binding.SourceTouch >= 0) {
+          if (   binding.SourceTouch < ETouchIndex::MAX_TOUCHES
+              && (frame.Touches & (1u << binding.SourceTouch))) {
+            auto const & finger =
+              Local->TouchFingerStates[binding.SourceTouch];
+            value = pure::Vector2DFromVector(
+              finger.Location - finger.FrameLocation);
+          }
+        }
+        else if (binding.SourceFinger < 0)
+          value = frame.CentroidDelta;
+        else if (binding.SourceFinger < frame.Fingers) {
+          auto const & finger = *frame.Pressed[binding.SourceFinger];
+          value = pure::Vector2DFromVector(
+            finger.Location - finger.FrameLocation);
+        }
+        break;
+      case EAlkTouchGesture::Pinch:
+        value = FVector2D(frame.Pinch, 0.f);
+        break;
+      case EAlkTouchGesture::Rotate:
+        value = FVector2D(frame.Rotate / 360.f * ViewportDivisor.X, 0.f);
+        break;
+      default:
+        return; // !!! Tap and Hold are recognized apart from drags
     }
-    if (FingerIndex == FingerIndexTurn // TODO: ### assuming Touch1
-        && !TouchFingerStates[FingerIndexMoveOnly].bPressed) { // TODO: ### assuming Touch3
-      if (TouchFingerStates[FingerIndexMove].bPressed)
-        DragTurnByViewportDelta(FVector2D(locDelta.X, 0.f));
-      else
-        DragTurnByViewportDelta(pure::Vector2DFromVector(locDelta));
+    if (value.X == 0.f && value.Y == 0.f)
+      return;
+    switch (binding.Action) {
+      case EAlkTouchGestureAction::Move:
+        DragMoveByViewportDelta(value);
+        break;
+      case EAlkTouchGestureAction::Turn:
+        DragTurnByViewportDelta(value);
+        break;
+      case EAlkTouchGestureAction::TurnYaw:
+        DragTurnByViewportDelta(FVector2D(value.X, 0.f));
+        break;
+      case EAlkTouchGestureAction::Zoom:
+        if (face_mut.AlkFollowBoom && ViewportDivisor.X > 0.f)
+          face_mut.AlkFollowBoom->TargetArmLength = FMath::Max(0.f,
+            face_mut.AlkFollowBoom->TargetArmLength
+            - (value.X / ViewportDivisor.X)
+              * face.AlkInputDragMoveMetersPerViewport.Z * 100.f);
+        break;
+      case EAlkTouchGestureAction::Notify:
+        BroadcastTouchGesture(binding.Gesture, frame.Fingers, value);
+        break;
+      default:
+        break;
     }
   }
 
+  void RecognizeTouchGesture(
+    EAlkTouchGesture const gesture,
+    int const fingers,
+    uint32 const touches, // !!! still pressed, so none after a Tap
+    FVector2D const & value
+  ) {
+    // !!! Tap and Hold carry no drag so they can only be Notify bindings
+    for (auto const & binding : face.AlkTouchGestures)
+      if (   binding.Gesture == gesture
+          && binding.Action == EAlkTouchGestureAction::Notify
+          && TouchGestureBindingMatches(binding, fingers, touches)) {
+        BroadcastTouchGesture(gesture, fingers, value);
+        return;
+      }
+  }
+
+  void BroadcastTouchGesture(
+    EAlkTouchGesture const gesture,
+    int const fingers,
+    FVector2D const & value
+  ) {
+    face_mut.AlkOnTouchGestureNative.Broadcast(face_mut, gesture, fingers, value);
+    face_mut.AlkOnTouchGesture.Broadcast(&face_mut, gesture, fingers, value);
+  }
+
   void InputTouchPressed(
     ETouchIndex::Type const FingerIndex,
     FVector const Location
   ) {
-    if (face.AlkTracing)
-      UKismetSystemLibrary::PrintString(&face_mut, FString(TEXT("InputTouchPressed(...)")));
-    if (FingerIndex > ETouchIndex::MAX_TOUCHES)
+    ALK_TRACE(face, CategoryInput, InputTouchPressed,
+      FingerIndex, Location.X, Location.Y);
+    if (FingerIndex >= ETouchIndex::MAX_TOUCHES)
       return; // TODO: @@@ LOG FAILURE
-    if (TouchFingerStates[FingerIndex].bPressed)
+    if (Local->TouchFingerStates[FingerIndex].bPressed)
       return; // TODO: @@@ LOG FAILURE
-    TouchFingerStates[FingerIndex].Location = Location;
-    TouchFingerStates[FingerIndex].bDragged = false;
-    TouchFingerStates[FingerIndex].bPressed = true;
-    TouchFingerStates[FingerIndex].PressedRealTimeSeconds =
-      pure::WorldRealTimeSeconds(face.GetWorld());
+    Local->TouchFingerStates[FingerIndex].Location = Location;
+    Local->TouchFingerStates[FingerIndex].FrameLocation = Location;
+    Local->TouchFingerStates[FingerIndex].bDragged = false;
+    Local->TouchFingerStates[FingerIndex].bHoldRecognized = false;
+    Local->TouchFingerStates[FingerIndex].bPressed = true;
+    Local->TouchFingerStates[FingerIndex].PressedRealTimeSeconds =
+      ReadRealTimeSeconds();
     if (FingerIndex == FingerIndexFire) {
       HandleFireOrHoldPressed(Location);
       UpdatePointerWorldFromViewport(
@@ -542,14 +1544,23 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
     ETouchIndex::Type const FingerIndex,
     FVector const Location
   ) {
-    if (face.AlkTracing)
-      UKismetSystemLibrary::PrintString(&face_mut, FString(TEXT("InputTouchReleased(...)")));
-    if (FingerIndex > ETouchIndex::MAX_TOUCHES)
+    ALK_TRACE(face, CategoryInput, InputTouchReleased,
+      FingerIndex, Location.X, Location.Y);
+    if (FingerIndex >= ETouchIndex::MAX_TOUCHES)
       return; // TODO: @@@ LOG FAILURE
-    if (!TouchFingerStates[FingerIndex].bPressed)
+    if (!Local->TouchFingerStates[FingerIndex].bPressed)
       return; // TODO: @@@ LOG FAILURE
-    TouchFingerStates[FingerIndex].Location = Location;
-    TouchFingerStates[FingerIndex].bPressed = false;
+    auto & finger = Local->TouchFingerStates[FingerIndex];
+    if (   !finger.bDragged && !finger.bHoldRecognized
+        && (ReadRealTimeSeconds() - finger.PressedRealTimeSeconds)
+           < face.AlkInputHoldThresholdSeconds) {
+      auto fingers = 0;
+      for (auto const & other : Local->TouchFingerStates)
+        fingers += other.bPressed ? 1 : 0;
+      Local->TapFingers = FMath::Max(Local->TapFingers, fingers);
+    }
+    finger.Location = Location;
+    finger.bPressed = false;
     if (FingerIndex == FingerIndexFire)
       HandleFireOrHoldReleased(Location);
   }
@@ -565,10 +1576,8 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
         InputMoveRight(meters.X * 100.f);
       if (meters.Y != 0.f)
         InputMoveForward(meters.Y * -100.f);
-      if (face.AlkTracing)
-        UKismetSystemLibrary::PrintString(&face_mut,
-          FString::Printf(TEXT("DragMoveByViewportDelta((%f,%f)): vpRatio (%f,%f), meters (%f,%f)"),
-            deltaPos.X, deltaPos.Y, vpRatio.X, vpRatio.Y, meters.X, meters.Y));
+      ALK_TRACE(face, CategoryDrag, DragMoveByViewportDelta,
+        deltaPos.X, deltaPos.Y, vpRatio.X, vpRatio.Y, meters.X, meters.Y);
     }
   }
 
@@ -596,10 +1605,8 @@ struct AAlkCharacterImpl: AAlkCharacter::Impl {
           face_mut.AlkFollowBoom->AddRelativeRotation(FRotator(-degrees.Y,0,0));
         //}
       }
-      if (face.AlkTracing)
-        UKismetSystemLibrary::PrintString(&face_mut,
-          FString::Printf(TEXT("DragTurnByViewportDelta((%f,%f)): vpRatio (%f,%f), degrees (%f,%f)"),
-            deltaPos.X, deltaPos.Y, vpRatio.X, vpRatio.Y, degrees.X, degrees.Y));
+      ALK_TRACE(face, CategoryDrag, DragTurnByViewportDelta,
+        deltaPos.X, deltaPos.Y, vpRatio.X, vpRatio.Y, degrees.X, degrees.Y);
     }
   }
 
@@ -641,13 +1648,7 @@ void AAlkCharacter::completeConstruction(int const inOptions) {
     VRReplicatedCamera->SetRelativeLocation(
       FVector(0.f, 0.f, 165.f)); // default human eye height
 
-#if 0 // TODO: @@@ MAY BE MORE EFFICIENT THAN CHECKING IN TICK BELOW
-  auto vrNotifComp = CreateDefaultSubobject<UVRNotificationsComponent>(TEXT("AlkVRNotifications"));
-  vrNotifComp->SetupAttachment(RootComponent)
-  vrNotifComp->HMDPutOnHeadDelegate = FVRNotificationsDelegate(
-  vrNotifComp->HMDRemovedFromHeadDelegate = FVRNotificationsDelegate(
-  vrNotifComp->VRControllerRecenteredDelegate = FVRNotificationsDelegate(
-#endif
+  // !!! HMD put on/removed notifications are subscribed by AlkHMDPresence
 
 #if 0 // TODO: @@@ DEPRECATED, NOW SEEMS UNNECESSARY SUBCLASSING AVRCharacter
   // !!! insert HMD offset to adjust its incorrect location within the capsule [c4augustus]
@@ -674,7 +1675,10 @@ void AAlkCharacter::completeConstruction(int const inOptions) {
   );
 #endif
 
-  if (HasAnyOptions(OPTION_CAN_SHOOT)) {
+  if (!HasAnyOptions(OPTION_REMOTE_LITE))
+    downcast_mut(impl).Local = MakeUnique<AAlkCharacterImpl::LocalState>();
+
+  if (HasAnyOptions(OPTION_CAN_SHOOT) && !HasAnyOptions(OPTION_REMOTE_LITE)) {
     AlkNodeShootMotionControllerL =
       CreateDefaultSubobject<UGripMotionControllerComponent>(
         TEXT("AlkNodeShootMotionControllerL"));
@@ -685,7 +1689,10 @@ void AAlkCharacter::completeConstruction(int const inOptions) {
       AlkNodeShootMotionControllerL->SetupAttachment(LeftMotionController);
     if (RightMotionController)
       AlkNodeShootMotionControllerR->SetupAttachment(RightMotionController);
+  }
+  if (HasAnyOptions(OPTION_CAN_SHOOT)) {
     AlkShootOffset = FVector(0.f, 0.f, 0.f);
+    AlkProjectilePoolPrewarm = 8;
   }
   // blueprintables
   AlkInputDragMoveMetersPerViewport = FVector(10.f, 10.f, 10.f);
@@ -696,13 +1703,47 @@ void AAlkCharacter::completeConstruction(int const inOptions) {
     // !!! InputPitchScale (default -2.5)
   AlkFireRapidLimit = 0;
   AlkPickRange = 1000.f;
+  AlkPickConeDegrees = 2.f;
+  AlkPickGazeRadius = 0.f;
+  AlkPickRayRetraceMinDistance = 0.5f;
+  AlkPickRayRetraceMinDegrees = 0.25f;
+  AlkPickRayRetraceMaxSeconds = 0.25f;
   AlkInputDragThresholdPixels = 4.f;
   AlkInputFireRapidThresholdSeconds = 0.2f;
   AlkInputHoldThresholdSeconds = 0.3f;
+  AlkTickHMD.TickInterval = HMDUpdateFrequencySeconds;
+  AlkTickPickRay.TickGroup = TG_PostPhysics; // !!! sees this frame's movement
+  AlkPickRayTickPointers = AAlkCharacterImpl::PointerBit(EAlkPointer::Camera);
+  AlkIntentBatchSeconds = 0.05f;
+  AlkIntentRewindSeconds = 0.25f;
+  AlkIntentOriginToleranceCm = 250.f;
+  AlkPickTargets.SetNum(int(EAlkPointer::Count));
+  // !!! default table keys on finger identity like the former fixed roles:
+  // !!! Touch2 moves, Touch1 turns, only horizontally while Touch2 is down,
+  // !!! and not at all while Touch3 is down
+  auto constexpr touch2 = 1 << ETouchIndex::Touch2;
+  auto constexpr touch3 = 1 << ETouchIndex::Touch3;
+  AlkTouchGestures = {
+    {0, EAlkTouchGesture::Pan, EAlkTouchGestureAction::Move, -1,
+      ETouchIndex::Touch2, 0, 0},
+    {0, EAlkTouchGesture::Pan, EAlkTouchGestureAction::Turn, -1,
+      ETouchIndex::Touch1, 0, touch2 | touch3},
+    {0, EAlkTouchGesture::Pan, EAlkTouchGestureAction::TurnYaw, -1,
+      ETouchIndex::Touch1, touch2, touch3},
+  };
   AlkLookRateDegPerSec = 45.f;
   AlkTurnRateDegPerSec = 45.f;
   AlkTurnSnapDeg = 5.f;
-
+  AlkSnapMoveDistance = 150.f;
+  AlkSnapMoveFadeSeconds = 0.1f;
+  AlkSnapMoveToleranceCm = 30.f;
+  AlkSnapMoveToleranceDegrees = 15.f;
+  AlkHMDNoiseFloorCm = 0.5f;
+  AlkHMDNoiseFloorDegrees = 0.5f;
+  AlkHMDUnwornAfterStillSeconds = 10.f;
+
+  if (HasAnyOptions(OPTION_REMOTE_LITE))
+    return; // !!! see AAlkCharacterImpl::EstablishLocal()
 # // TODO: $$$ see AlkAcquireMutFollowBoom() below for FP lazy acquisition that UE cannot deal with for some reason
   AlkFollowBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("AlkFollowBoom"));
   AlkFollowBoom->SetupAttachment(RootComponent);
@@ -712,15 +1753,49 @@ void AAlkCharacter::completeConstruction(int const inOptions) {
 
 void AAlkCharacter::PostInitializeComponents() {
   Super::PostInitializeComponents();
+  WarnUnsupportedTouchGestures(*this);
+  auto const path = alkchar::ScriptFilePath("alkchar.aboa");
+  FDateTime stamp;
+  auto const reload = alkchar::ScriptCacheAcquireReload(path, stamp);
+    // ^ !!! reloads only when not yet cached or edited (editor builds)
   auto results = runCachedAboaUeCodeAtPath(
-    codeFilePath("alkchar.aboa"), "alkchar-init",
+    path, "alkchar-init",
     makeAboaUeDataDict({
       {"uobject", makeAboaUeDataUobjectRef(*this)}}),
-    true); // forceReload TODO: ### UNTIL AUTO-RELOAD IS IMPLEMENTED
+    reload);
+  if (reload)
+    alkchar::ScriptCacheLoaded(path, stamp, alkchar::ScriptSucceeded(results));
   //PrintStringToScreen(dumpAboaUeDataDict(results));
     // ^ TODO: ### TRACING
   //PrintStringToScreen(stringFromAboaUeDataDict(results, "result"));
     // ^ TODO: ### TRACING
+  AlkRefreshScriptSubscriptions(); // !!! alkchar-init resets subscribers
+}
+
+#if WITH_EDITOR
+void AAlkCharacter::PostEditChangeProperty(
+  FPropertyChangedEvent & PropertyChangedEvent
+) {
+  Super::PostEditChangeProperty(PropertyChangedEvent);
+  if (   PropertyChangedEvent.GetMemberPropertyName()
+      == GET_MEMBER_NAME_CHECKED(AAlkCharacter, AlkTouchGestures))
+    WarnUnsupportedTouchGestures(*this);
+}
+#endif
+
+void AAlkCharacter::AlkRefreshScriptSubscriptions() {
+  auto & im = downcast_mut(impl);
+  auto & calls = im.EstablishScriptCalls();
+  im.SubscribeScriptTick(calls.TickSubscription.CallForResultString());
+  alkchar::ScriptSubscriptionsInvalidate();
+}
+
+void AAlkCharacter::AlkScriptSubscriptionChanged(
+  FName Event,
+  bool bSubscribed
+) {
+  if (Event == TEXT("alkchar-pick-ray-target"))
+    alkchar::ScriptPickRayTargetSubscriptionChanged(bSubscribed);
 }
 
 void AAlkCharacter::SetupPlayerInputComponent(
@@ -730,13 +1805,14 @@ void AAlkCharacter::SetupPlayerInputComponent(
   Super::SetupPlayerInputComponent(PlayerInputComponent);
   if (!PlayerInputComponent)
     return; // TODO: @@@ LOG FAILURE
+  downcast_mut(impl).EstablishLocal(); // !!! only locally controlled get here
   // TODO: @@@ REFACTOR THESE BINDINGS TO DELEGATE THROUGH UOBJECT DELEGATE
   PlayerInputComponent->BindAction("AlkFireOrHold", IE_Pressed, this, &AAlkCharacter::InputFireOrHoldPressed);
   PlayerInputComponent->BindAction("AlkFireOrHold", IE_Released, this, &AAlkCharacter::InputFireOrHoldReleased);
   PlayerInputComponent->BindAction("AlkRecenterXR", IE_Pressed, this, &AAlkCharacter::InputRecenterXR);
   if (!HasAnyOptions(OPTION_NO_JUMP)) {
-    PlayerInputComponent->BindAction("AlkJump", IE_Pressed, this, &ACharacter::Jump);
-    PlayerInputComponent->BindAction("AlkJump", IE_Released, this, &ACharacter::StopJumping);
+    PlayerInputComponent->BindAction("AlkJump", IE_Pressed, this, &AAlkCharacter::InputJumpPressed);
+    PlayerInputComponent->BindAction("AlkJump", IE_Released, this, &AAlkCharacter::InputJumpReleased);
   }
   if (!HasAnyOptions(OPTION_NO_MOVE)) {
     PlayerInputComponent->BindAxis("AlkMoveForward", this, &AAlkCharacter::InputMoveForward);
@@ -758,9 +1834,9 @@ void AAlkCharacter::SetupPlayerInputComponent(
   PlayerInputComponent->BindAxis("AlkMouseX", this, &AAlkCharacter::InputMouseAxis);
   PlayerInputComponent->BindAxis("AlkMouseY", this, &AAlkCharacter::InputMouseAxis);
 
-  PlayerInputComponent->BindAxis("AlkLook", this, &APawn::AddControllerPitchInput);
+  PlayerInputComponent->BindAxis("AlkLook", this, &AAlkCharacter::InputLook);
   PlayerInputComponent->BindAxis("AlkLookRate", this, &AAlkCharacter::InputLookRate);
-  PlayerInputComponent->BindAxis("AlkTurn", this, &APawn::AddControllerYawInput);
+  PlayerInputComponent->BindAxis("AlkTurn", this, &AAlkCharacter::InputTurn);
   PlayerInputComponent->BindAxis("AlkTurnRate", this, &AAlkCharacter::InputTurnRate);
 
   if (FPlatformMisc::GetUseVirtualJoysticks()
@@ -769,61 +1845,198 @@ void AAlkCharacter::SetupPlayerInputComponent(
     PlayerInputComponent->BindTouch(EInputEvent::IE_Released, this, &AAlkCharacter::InputTouchReleased);
     PlayerInputComponent->BindTouch(EInputEvent::IE_Repeat, this, &AAlkCharacter::InputTouchDragged);
   }
-  auto results = callLoadedAboaUeCode(
-    "alkchar-input-setup",
-    makeAboaUeDataDict({
-      {"uobject", makeAboaUeDataUobjectRef(*this)}}));
+  downcast_mut(impl).EstablishScriptCalls().InputSetup.Call();
 }
 
 void AAlkCharacter::BeginPlay() {
   Super::BeginPlay();
-  AlkFollowBoom->SetRelativeLocation(
-    FVector(.0, .0, 1.5*GetCapsuleComponent()->GetScaledCapsuleHalfHeight()));
-  AlkFollowCamera->SetRelativeLocation(
-    FVector(.0, 25.0, .0)); // TODO: ### HARDCODED OFFSET TO RIGHT SHOULDER
-  AlkFollowCamera->AttachToComponent(
-    AlkFollowBoom,
-    FAttachmentTransformRules::KeepRelativeTransform,
-    USpringArmComponent::SocketName);
+  downcast_mut(impl).EstablishFollowCamera();
   downcast_mut(impl).EstablishThirdPerson(); // TODO: ### FORCED FOR NOW
+  downcast_mut(impl).HMDPresence.Start();
+  if (bAlkBatchedTimers)
+    downcast_mut(impl).StartBatchedTimers();
+  if (bAlkReplicatedIntents && HasAuthority())
+    downcast_mut(impl).StartIntentValidation();
+  auto const world = GetWorld();
+  if (   world && bAlkProjectilePooling && AlkProjectileClass
+      && HasAnyOptions(OPTION_CAN_SHOOT)) {
+    auto const pool = world->GetSubsystem<UAlkProjectilePool>();
+    if (pool)
+      pool->Prewarm(AlkProjectileClass, AlkProjectilePoolPrewarm);
+  }
+}
+
+void AAlkCharacter::EndPlay(EEndPlayReason::Type const EndPlayReason) {
+  downcast_mut(impl).HMDPresence.Stop();
+  downcast_mut(impl).StopBatchedTimers();
+  if (downcast(impl).PendingIntents.Num() > 0)
+    downcast_mut(impl).FlushIntents(); // !!! last shots before leaving
+  downcast_mut(impl).StopIntentValidation();
+  Super::EndPlay(EndPlayReason);
+}
+
+void AAlkCharacter::GetLifetimeReplicatedProps(
+  TArray<FLifetimeProperty> & OutLifetimeProps
+) const { // override
+  Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+  DOREPLIFETIME_CONDITION(AAlkCharacter, AlkPickTargets, COND_SkipOwner);
+    // ^ !!! the owner already knows its own targets
+}
+
+bool AAlkCharacter::ServerAlkIntents_Validate(
+  TArray<FAlkIntent> const & Intents
+) {
+  return Intents.Num() <= UAlkIntentValidator::BatchMax;
+    // ^ !!! more than a client can queue, so the client is not ours
+}
+
+void AAlkCharacter::ServerAlkIntents_Implementation(
+  TArray<FAlkIntent> const & Intents
+) {
+  auto const & im = downcast(impl);
+  auto const validator = im.IntentValidator.Get();
+  if (validator && (im.IntentValidatorSlot != INDEX_NONE)) {
+    validator->Queue(im.IntentValidatorSlot, Intents); // !!! next pass
+    return;
+  }
+  ALK_STAT_COUNT(IntentsRejected, Intents.Num());
+  for (auto const & intent : Intents)
+    ALK_TRACE(*this, CategoryNet, IntentRejected,
+      int(intent.Kind), UAlkIntentValidator::REJECT_UNKNOWN);
+}
+
+void AAlkCharacter::AlkQueueIntent(
+  EAlkIntentKind const kind,
+  EAlkPointer const pointer,
+  FVector const & origin,
+  FVector const & direction
+) {
+  auto & im = downcast_mut(impl);
+  if (im.SendsIntents())
+    im.QueueIntent(kind, pointer, origin, direction);
+}
+
+void AAlkCharacter::AlkApplyValidatedIntent(
+  FAlkIntent const & intent,
+  FHitResult const & hitres
+) {
+  auto & im = downcast_mut(impl);
+  switch (intent.Kind) {
+    case EAlkIntentKind::Shoot:
+      if (HasAnyOptions(OPTION_CAN_SHOOT))
+        im.SpawnProjectile(intent.Origin, intent.Direction.Rotation());
+      break;
+    case EAlkIntentKind::Pick:
+      im.SetPickTarget(EAlkPointer(intent.Pointer), hitres);
+      break;
+  }
+}
+
+void AAlkCharacter::AlkOnRepPickTargets(
+  TArray<FAlkPickTarget> const & Previous
+) {
+  auto & im = downcast_mut(impl);
+  for (int p = 0; p < AlkPickTargets.Num(); ++p) {
+    auto const & target = AlkPickTargets[p];
+    if (   Previous.IsValidIndex(p)
+        && (Previous[p].Actor     == target.Actor)
+        && (Previous[p].Component == target.Component))
+      continue;
+    im.BroadcastPointerTarget(EAlkPointer(p),
+      target.Actor.Get(), target.Component.Get());
+  }
+}
+
+void AAlkCharacter::AlkApplyBatchedTimerEvents(
+  uint8 const events,
+  float const hmdSeconds
+) {
+  auto & im = downcast_mut(impl);
+  if (events & UAlkCharacterTimers::EVENT_FIRE_RAPID_STOP)
+    im.StopFireMeasuring();
+  if ((events & UAlkCharacterTimers::EVENT_HOLD_ENTER) && !AlkHolding)
+    im.EnterHoldingAfterThreshold();
+  if (events & UAlkCharacterTimers::EVENT_HMD_SAMPLE)
+    im.UpdateHMDState(hmdSeconds);
+}
+
+void AAlkCharacter::AlkSetHMDPoseSource(
+  TUniquePtr<pure::HMDPoseSource> source
+) {
+  downcast_mut(impl).HMDPresence.SetPoseSource(MoveTemp(source));
 }
 
 void AAlkCharacter::Tick(float DeltaSeconds) { // override
+  ALK_STAT_SCOPE(Tick);
   Super::Tick(DeltaSeconds);
-  downcast_mut(impl).UpdateHMDState(DeltaSeconds);
-  downcast_mut(impl).UpdateInputState(DeltaSeconds);
-  auto results = callLoadedAboaUeCode(
-    "alkchar-tick",
-    makeAboaUeDataDict({
-      {"uobject", makeAboaUeDataUobjectRef(*this)},
-      {"delta",   makeAboaUeDataFloat(DeltaSeconds)}}));
-  if (AlkPickRayTickEnabled) {
-    auto &     hitresprev = downcast_mut(impl).PickRayHitResultTick;
-    FHitResult hitresnext;
-    AlkPickRayCameraHit(hitresnext);
-    if (   (hitresnext.HitObjectHandle != hitresprev.HitObjectHandle)
-        || (hitresnext.Component       != hitresprev.Component)) {
-      hitresprev = hitresnext;
-      AlkPickRayTarget(
-        hitresnext.HitObjectHandle.FetchActor(), // !!! obviously already loaded
-        hitresnext.Component.Get());
-    }
+  downcast_mut(impl).UpdateIntents(DeltaSeconds); // !!! batched to the server
+  // !!! the features tick separately, see RegisterActorTickFunctions()
+}
+
+void AAlkCharacter::RegisterActorTickFunctions(bool bRegister) { // override
+  Super::RegisterActorTickFunctions(bRegister);
+  downcast_mut(impl).RegisterFeatureTicks(bRegister);
+}
+
+void AAlkCharacter::NotifyControllerChanged() { // override
+  Super::NotifyControllerChanged();
+  downcast_mut(impl).LinkInputTickToController();
+}
+
+void AAlkCharacter::AlkApplyFeatureTicks() {
+  downcast_mut(impl).RegisterFeatureTicks(
+    PrimaryActorTick.IsTickFunctionRegistered());
+}
+
+void AAlkCharacter::AlkTickFeatures(float const DeltaSeconds) {
+  auto & im = downcast_mut(impl);
+  im.TickInput(DeltaSeconds);
+  im.HMDInlineSeconds += DeltaSeconds;
+  if (im.HMDInlineSeconds >= AlkTickHMD.TickInterval) {
+    im.UpdateHMDState(im.HMDInlineSeconds);
+    im.HMDInlineSeconds = 0.f;
   }
+  im.UpdateScriptTick(DeltaSeconds);
+  im.TickPickRay(DeltaSeconds);
 }
 
-#if 0 // TODO: ### FOR SCREEN TO WORLD COORDINATES
-struct LocationRotation {
-  FVector Location;
-  FVector Rotation;
-};
+void AAlkCharacter::AlkPickRayApplyTickHit(FHitResult const & hitresnext) {
+  AlkPickRayApplyPointerHit(EAlkPointer::Camera, hitresnext);
+}
 
-static LocationRotation GazeToWorld(
-  UWorld* World,
-  FVector const ScreenCoordinates
+void AAlkCharacter::AlkPickRayApplyPointerHit(
+  EAlkPointer const pointer,
+  FHitResult const & hitresnext
 ) {
-
+  auto & im = downcast_mut(impl);
+  auto & local = im.Local;
+  if (!local || (pointer >= EAlkPointer::Count))
+    return; // !!! not locally possessed with OPTION_REMOTE_LITE
+  auto & hitresprev = local->PickRayHitResultsTick[int(pointer)];
+  if (   (hitresnext.HitObjectHandle == hitresprev.HitObjectHandle)
+      && (hitresnext.Component       == hitresprev.Component))
+    return;
+  hitresprev = hitresnext;
+  auto const actor = hitresnext.HitObjectHandle.FetchActor();
+    // ^ !!! obviously already loaded
+  auto const component = hitresnext.Component.Get();
+  im.BroadcastPointerTarget(pointer, actor, component);
+  if (bAlkReplicatedIntents) {
+    if (HasAuthority())
+      im.SetPickTarget(pointer, hitresnext); // !!! listen server host
+    else if (im.SendsIntents()) {
+      auto const & sched = im.PickRaySchedulesTick[int(pointer)];
+      im.QueueIntent(EAlkIntentKind::Pick, pointer,
+        sched.Location, sched.Forward); // !!! the ray just traced
+    }
+  }
+  if (pointer != EAlkPointer::Camera)
+    return;
+  // !!! native listeners first, whatever a Blueprint override does
+  AlkOnPickRayTargetChangedNative.Broadcast(*this, actor, component);
+  AlkOnPickRayTargetChanged.Broadcast(this, actor, component);
+  AlkPickRayTarget(actor, component);
 }
-#endif
 
 void AAlkCharacter::AlkOnHoldEnter_Implementation(
   FVector const & ScreenCoordinates
@@ -838,7 +2051,8 @@ void AAlkCharacter::AlkOnHoldLeave_Implementation(
 }
 
 void AAlkCharacter::AlkOnHoldMove_Implementation(
-  FVector const & ScreenCoordinates
+  FVector const & ScreenCoordinates,
+  FVector const & Delta
 ) {
   // TODO: ### IMPLEMENT
 }
@@ -867,29 +2081,40 @@ AAlkCharacter::AlkAcquireMutFollowBoom() {
 void AAlkCharacter::AlkOnShoot_Implementation(
   FVector const & ScreenCoordinates
 ) {
-  if (AlkTracing)
-    UKismetSystemLibrary::PrintString(this, FString(TEXT("AlkOnShoot_Implementation(...)")));
+  ALK_TRACE(*this, CategoryFire, OnShoot);
   if (!HasAnyOptions(OPTION_CAN_SHOOT))
     return;
-  auto world = GetWorld();
-  if (world && AlkProjectileClass) {
-    FRotator const SpawnRotation = bAlkUsingMotionControllers
-      ? (bAlkShootFromMotionControllerLeftNotRight
-        ? AlkNodeShootMotionControllerL->GetComponentRotation()
-        : AlkNodeShootMotionControllerR->GetComponentRotation())
+  ALK_STAT_SCOPE(OnShoot);
+  if (GetWorld() && AlkProjectileClass) {
+    USceneComponent const * const ShootNode = !bAlkUsingMotionControllers
+      ? nullptr
+      : bAlkShootFromMotionControllerLeftNotRight
+        ? (AlkNodeShootMotionControllerL
+          ? AlkNodeShootMotionControllerL.Get() : LeftMotionController.Get())
+        : (AlkNodeShootMotionControllerR
+          ? AlkNodeShootMotionControllerR.Get() : RightMotionController.Get());
+          // ^ !!! OPTION_REMOTE_LITE pawns may not have shoot nodes
+    FRotator const SpawnRotation = ShootNode
+      ? ShootNode->GetComponentRotation()
       : GetControlRotation();
-    FVector const SpawnLocation = (bAlkUsingMotionControllers
-      ? (bAlkShootFromMotionControllerLeftNotRight
-        ? AlkNodeShootMotionControllerL->GetComponentLocation()
-        : AlkNodeShootMotionControllerR->GetComponentLocation())
+    FVector const SpawnLocation = (ShootNode
+      ? ShootNode->GetComponentLocation()
       : (AlkNodeShootDefault)
         ? AlkNodeShootDefault->GetComponentLocation()
         : GetActorLocation()
      ) + SpawnRotation.RotateVector(AlkShootOffset);
-    FActorSpawnParameters ActorSpawnParams;
-    ActorSpawnParams.SpawnCollisionHandlingOverride =
-      ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButDontSpawnIfColliding;
-    world->SpawnActor<AActor>(AlkProjectileClass, SpawnLocation, SpawnRotation, ActorSpawnParams);
+    auto & im = downcast_mut(impl);
+    if (im.SendsIntents())
+      im.QueueIntent(EAlkIntentKind::Shoot,
+        !bAlkUsingMotionControllers
+          ? EAlkPointer::Camera
+          : bAlkShootFromMotionControllerLeftNotRight
+            ? EAlkPointer::Left
+            : EAlkPointer::Right,
+        SpawnLocation, SpawnRotation.Vector());
+          // ^ !!! the server spawns it once validated
+    else
+      im.SpawnProjectile(SpawnLocation, SpawnRotation);
   }
   if (AlkShootSound)
     UGameplayStatics::PlaySoundAtLocation(
@@ -900,8 +2125,8 @@ void AAlkCharacter::AlkOnFire_Implementation(
   FVector const & ScreenCoordinates,
   int RapidCount
 ) {
-  if (AlkTracing)
-    UKismetSystemLibrary::PrintString(this, FString(TEXT("AlkOnFire_Implementation(...)")));
+  ALK_TRACE(*this, CategoryFire, OnFire,
+    ScreenCoordinates.X, ScreenCoordinates.Y, RapidCount);
   if (HasAnyOptions(OPTION_CAN_SHOOT))
     AlkOnShoot(ScreenCoordinates);
 }
@@ -912,18 +2137,32 @@ AAlkCharacter::AlkPickRayHit_Implementation(
   FVector const & Direction,
   FHitResult    & OutHitResult
 ) {
+  static TArray<AActor*> const NoActorsToIgnore;
+  if (bAlkPickRayUseRegistry) {
+    auto const world = GetWorld();
+    auto const registry = world
+      ? world->GetSubsystem<UAlkPickableRegistry>()
+      : nullptr;
+    if (registry)
+      return registry->Pick(Location, Direction, AlkPickRange,
+        AlkPickConeDegrees, AlkPickGazeRadius, OutHitResult);
+  }
+  ALK_STAT_SCOPE(PickRayTrace);
+  ALK_STAT_COUNT(PickRayTraces, 1);
   FVector const Endpoint = Location + (Direction * AlkPickRange);
   return UKismetSystemLibrary::LineTraceSingle(
     this, Location, Endpoint,
     ETraceTypeQuery::TraceTypeQuery1, // in EngineTypes.h, Visibility?
     false,                // bTraceComplex
-    TArray<AActor*>(),    // ActorsToIgnore
+    NoActorsToIgnore,     // ActorsToIgnore
     EDrawDebugTrace::None,
     OutHitResult, true);  // bIgnoreSelf
 }
 
 bool
 AAlkCharacter::AlkPickRayCameraHit_Implementation(FHitResult& hitres) {
+  if (!AlkCameraActive)
+    return false; // !!! not locally possessed with OPTION_REMOTE_LITE
   return AlkPickRayHit_Implementation(
     AlkCameraActive->GetComponentLocation(),
     AlkCameraActive->GetForwardVector(),
@@ -932,14 +2171,30 @@ AAlkCharacter::AlkPickRayCameraHit_Implementation(FHitResult& hitres) {
 
 bool
 AAlkCharacter::AlkPickRayPointerHit_Implementation(FHitResult& hitres) {
-  return AlkPickRayHit_Implementation(
-    bAlkUsingMotionControllers
-      ? RightMotionController->GetComponentLocation() // TODO: ### ONLY RIGHT
-      : AlkCameraActive      ->GetComponentLocation(),
-    bAlkUsingMotionControllers
-      ? RightMotionController->GetForwardVector()
-      : AlkPointerWorldDirection,
-    hitres);
+  if (!bAlkUsingMotionControllers) {
+    if (!AlkCameraActive)
+      return false; // !!! not locally possessed with OPTION_REMOTE_LITE
+    return AlkPickRayHit_Implementation(
+      AlkCameraActive->GetComponentLocation(), AlkPointerWorldDirection,
+      hitres);
+  }
+  FVector location, forward;
+  if (!downcast(impl).ReadPointerRay(
+        bAlkShootFromMotionControllerLeftNotRight
+          ? EAlkPointer::Left
+          : EAlkPointer::Right,
+        location, forward))
+    return false;
+  return AlkPickRayHit_Implementation(location, forward, hitres);
+}
+
+int32
+AAlkCharacter::AlkPickRayPointersHit(
+  int32 Pointers,
+  TArray<FHitResult>& OutHitResults
+) {
+  OutHitResults.SetNum(int(EAlkPointer::Count));
+  return downcast_mut(impl).PickPointers(Pointers, OutHitResults.GetData());
 }
 
 void
@@ -947,92 +2202,226 @@ AAlkCharacter::AlkPickRayTarget_Implementation(
   const AActor *              actor,
   const UPrimitiveComponent * component
 ) {
-  auto results = callLoadedAboaUeCode(
-    "alkchar-pick-ray-target",
-    makeAboaUeDataDict({
-      {"actor",     makeAboaUeDataUobjectPtr(actor)},
-      {"component", makeAboaUeDataUobjectPtr(component)},
-      {"uobject",   makeAboaUeDataUobjectRef(*this)}}));
+  auto & calls = downcast_mut(impl).EstablishScriptCalls();
+  if (!alkchar::ScriptPickRayTargetSubscribed(calls.PickRayTargetSubscription))
+    return; // !!! skip the interpreter round-trip
+  calls.PickRayTargetActor     = makeAboaUeDataUobjectPtr(actor);
+  calls.PickRayTargetComponent = makeAboaUeDataUobjectPtr(component);
+  calls.PickRayTarget.Call();
+}
+
+void AAlkCharacter::AlkInputRecordingStart() {
+  auto & im = downcast_mut(impl);
+  im.Recording = MakeUnique<alkinput::Recording>();
+  im.Recording->ViewportSize = FVector2f(im.ReadViewportSize());
+  im.RecordingFrame = 0;
+}
+
+auto AAlkCharacter::AlkInputRecordingStop(FString const & path) -> bool {
+  auto & im = downcast_mut(impl);
+  if (!im.Recording)
+    return false;
+  auto const saved = im.Recording->Save(path);
+  im.Recording.Reset();
+  return saved;
+}
+
+auto AAlkCharacter::AlkInputReplay(
+  alkinput::Recording const & recording
+) -> uint32 {
+  using alkinput::Kind;
+  auto & im = downcast_mut(impl);
+  im.EstablishLocal(); // !!! as if locally possessed
+  im.Replay = AAlkCharacterImpl::InputReplay();
+  im.Replay.bActive = true;
+  im.Replay.Viewport.Size = FVector2D(recording.ViewportSize);
+  im.Replay.Viewport.Divisor =
+    pure::ViewportDivisorFromSize(im.Replay.Viewport.Size);
+  im.Replay.Viewport.Version = MAX_uint32; // !!! differs from any live one
+  im.ViewportVersion = 0;
+  for (auto const & e : recording.Events) {
+    im.Replay.MousePosition = FVector2D(e.Mouse);
+    im.Replay.RealTimeSeconds = e.Seconds;
+    im.Replay.DeltaSeconds = e.DeltaSeconds;
+    auto const finger = ETouchIndex::Type(e.Finger);
+    auto const location = FVector(e.Location.X, e.Location.Y, 0.f);
+    switch (e.Type) {
+      case Kind::Frame:
+        im.Replay.DeltaSeconds = e.Value;
+        im.UpdateMouseState();
+        im.UpdateTouchState();
+        im.UpdateHoldMove();
+        im.UpdateInputState(e.Value);
+        break;
+      case Kind::FireOrHoldPressed:   im.InputFireOrHoldPressed();    break;
+      case Kind::FireOrHoldReleased:  im.InputFireOrHoldReleased();   break;
+      case Kind::RecenterXR:          break; // !!! no XR in replays
+      case Kind::MoveForward:         im.InputMoveForward(e.Value);   break;
+      case Kind::MoveRight:           im.InputMoveRight(e.Value);     break;
+      case Kind::TurnRate:            im.InputTurnRate(e.Value);      break;
+      case Kind::LookRate:            im.InputLookRate(e.Value);      break;
+      case Kind::MouseMovingDisable:  im.InputMouseMovingDisable();   break;
+      case Kind::MouseMovingEnable:   im.InputMouseMovingEnable();    break;
+      case Kind::MouseTurningDisable: im.InputMouseTurningDisable();  break;
+      case Kind::MouseTurningEnable:  im.InputMouseTurningEnable();   break;
+      case Kind::MouseAxis:           im.InputMouseAxis(e.Value);     break;
+      case Kind::SnapMoveBackward:    im.InputSnapMoveBackward();     break;
+      case Kind::SnapMoveForward:     im.InputSnapMoveForward();      break;
+      case Kind::SnapMoveLeft:        im.InputSnapMoveLeft();         break;
+      case Kind::SnapMoveRight:       im.InputSnapMoveRight();        break;
+      case Kind::SnapTurnBack:        im.InputSnapTurnBack();         break;
+      case Kind::SnapTurnLeft:        im.InputSnapTurnLeft();         break;
+      case Kind::SnapTurnRight:       im.InputSnapTurnRight();        break;
+      case Kind::ToggleAutoForward:   im.InputToggleAutoForward();    break;
+      case Kind::TouchDragged:  im.InputTouchDragged(finger, location);  break;
+      case Kind::TouchPressed:  im.InputTouchPressed(finger, location);  break;
+      case Kind::TouchReleased: im.InputTouchReleased(finger, location); break;
+      case Kind::Look:                AddControllerPitchInput(e.Value); break;
+      case Kind::Turn:                AddControllerYawInput(e.Value);   break;
+      case Kind::JumpPressed:         Jump();                           break;
+      case Kind::JumpReleased:        StopJumping();                    break;
+    }
+  }
+  im.Replay.bActive = false;
+  // !!! checksum of the input state machine only, i.e. impl state: the
+  // !!! pawn, controller and components it drives (movement input, boom,
+  // !!! pointer deprojection) depend on what EstablishLocal created and on
+  // !!! whether a controller possesses, so they are left out
+  TArray<uint8> state;
+  FMemoryWriter writer(state);
+  int32 fireRapidCount = im.FireRapidCount, fireRapidCurrent = im.FireRapidCurrent;
+  bool fireMeasuring = im.FireMeasuring, holdMeasuring = im.HoldMeasuring;
+  bool holding = AlkHolding, movingForward = im.bMovingForward;
+  bool movingRight = im.bMovingRight;
+  float autoForward = im.AutoForwardValue;
+  FVector2D mousePos = im.ViewportMousePosition;
+  writer << fireRapidCount << fireRapidCurrent << fireMeasuring << holdMeasuring
+         << holding << movingForward << movingRight << autoForward
+         << mousePos;
+  if (im.Local)
+    for (auto & finger : im.Local->TouchFingerStates)
+      writer << finger.bPressed << finger.bDragged << finger.Location;
+  return FCrc::MemCrc32(state.GetData(), state.Num());
 }
 
 // TODO: @@@ REFACTOR THESE BINDINGS TO DELEGATE THROUGH UOBJECT DELEGATE
 void AAlkCharacter::InputFireOrHoldPressed() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::FireOrHoldPressed);
   downcast_mut(impl).InputFireOrHoldPressed();
 }
 
 void AAlkCharacter::InputFireOrHoldReleased() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::FireOrHoldReleased);
   downcast_mut(impl).InputFireOrHoldReleased();
 }
 
 void AAlkCharacter::InputRecenterXR() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::RecenterXR);
   downcast_mut(impl).InputRecenterXR();
 }
 
 void AAlkCharacter::InputMoveForward(float const Value) {
+  downcast_mut(impl).RecordInput(alkinput::Kind::MoveForward, Value);
   downcast_mut(impl).InputMoveForward(Value);
 }
 
 void AAlkCharacter::InputMoveRight(float const Value) {
+  downcast_mut(impl).RecordInput(alkinput::Kind::MoveRight, Value);
   downcast_mut(impl).InputMoveRight(Value);
 }
 
+void AAlkCharacter::InputJumpPressed() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::JumpPressed);
+  Jump();
+}
+
+void AAlkCharacter::InputJumpReleased() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::JumpReleased);
+  StopJumping();
+}
+
+void AAlkCharacter::InputLook(float const Value) {
+  downcast_mut(impl).RecordInput(alkinput::Kind::Look, Value);
+  AddControllerPitchInput(Value);
+}
+
+void AAlkCharacter::InputTurn(float const Value) {
+  downcast_mut(impl).RecordInput(alkinput::Kind::Turn, Value);
+  AddControllerYawInput(Value);
+}
+
 void AAlkCharacter::InputTurnRate(float const Rate) {
+  downcast_mut(impl).RecordInput(alkinput::Kind::TurnRate, Rate);
   downcast_mut(impl).InputTurnRate(Rate);
 }
 
 void AAlkCharacter::InputLookRate(float const Rate) {
+  downcast_mut(impl).RecordInput(alkinput::Kind::LookRate, Rate);
   downcast_mut(impl).InputLookRate(Rate);
 }
 
 void AAlkCharacter::InputMouseMovingDisable() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::MouseMovingDisable);
   downcast_mut(impl).InputMouseMovingDisable();
 }
 
 void AAlkCharacter::InputMouseMovingEnable() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::MouseMovingEnable);
   downcast_mut(impl).InputMouseMovingEnable();
 }
 
 void AAlkCharacter::InputMouseTurningDisable() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::MouseTurningDisable);
   downcast_mut(impl).InputMouseTurningDisable();
 }
 
 void AAlkCharacter::InputMouseTurningEnable() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::MouseTurningEnable);
   downcast_mut(impl).InputMouseTurningEnable();
 }
 
 void AAlkCharacter::InputMouseAxis(float const Value) {
+  downcast_mut(impl).RecordInput(alkinput::Kind::MouseAxis, Value);
   downcast_mut(impl).InputMouseAxis(Value);
 }
 
 void AAlkCharacter::InputSnapMoveBackward() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::SnapMoveBackward);
   downcast_mut(impl).InputSnapMoveBackward();
 }
 
 void AAlkCharacter::InputSnapMoveForward() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::SnapMoveForward);
   downcast_mut(impl).InputSnapMoveForward();
 }
 
 void AAlkCharacter::InputSnapMoveLeft() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::SnapMoveLeft);
   downcast_mut(impl).InputSnapMoveLeft();
 }
 
 void AAlkCharacter::InputSnapMoveRight() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::SnapMoveRight);
   downcast_mut(impl).InputSnapMoveRight();
 }
 
 void AAlkCharacter::InputSnapTurnBack() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::SnapTurnBack);
   downcast_mut(impl).InputSnapTurnBack();
 }
 
 void AAlkCharacter::InputSnapTurnLeft() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::SnapTurnLeft);
   downcast_mut(impl).InputSnapTurnLeft();
 }
 
 void AAlkCharacter::InputSnapTurnRight() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::SnapTurnRight);
   downcast_mut(impl).InputSnapTurnRight();
 }
 
 void AAlkCharacter::InputToggleAutoForward() {
+  downcast_mut(impl).RecordInput(alkinput::Kind::ToggleAutoForward);
   downcast_mut(impl).InputToggleAutoForward();
 }
 
@@ -1040,6 +2429,8 @@ void AAlkCharacter::InputTouchDragged(
   ETouchIndex::Type const FingerIndex,
   FVector const Location
 ) {
+  downcast_mut(impl).RecordInput(
+    alkinput::Kind::TouchDragged, 0.f, FingerIndex, Location);
   downcast_mut(impl).InputTouchDragged(FingerIndex, Location);
 }
 
@@ -1047,6 +2438,8 @@ void AAlkCharacter::InputTouchPressed(
   ETouchIndex::Type const FingerIndex,
   FVector const Location
 ) {
+  downcast_mut(impl).RecordInput(
+    alkinput::Kind::TouchPressed, 0.f, FingerIndex, Location);
   downcast_mut(impl).InputTouchPressed(FingerIndex, Location);
 }
 
@@ -1054,6 +2447,8 @@ void AAlkCharacter::InputTouchReleased(
   ETouchIndex::Type const FingerIndex,
   FVector const Location
 ) {
+  downcast_mut(impl).RecordInput(
+    alkinput::Kind::TouchReleased, 0.f, FingerIndex, Location);
   downcast_mut(impl).InputTouchReleased(FingerIndex, Location);
 }
 
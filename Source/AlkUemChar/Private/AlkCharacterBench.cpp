@@ -0,0 +1,194 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+// Headless benchmark of AAlkCharacter tick and input cost, e.g.
+//   UnrealEditor-Cmd Game.uproject /Game/Maps/Bench -game -nullrhi -unattended
+//     -ExecCmds="alk.Bench.Characters 1,10,100,1000 300 pickray; quit"
+// writes Saved/Profiling/AlkBench/<timestamp>.json and .csv; the
+// allocation and memory columns are process-wide, see ReadAllocations
+// the automation test Alk.Char.Bench.Characters runs a short pass in CI
+//
+#include "AlkCharacter.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Async/TaskGraphInterfaces.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RenderingThread.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAlkBench, Log, All);
+
+struct AlkCharacterBench {
+  struct Result {
+    int Characters = 0;
+    int Frames = 0;
+    double TickMicrosPerCharacter = 0.0;
+    double TickMicrosPerCharacterMax = 0.0;
+    double PickRayMicrosPerCharacter = 0.0;
+    double AllocationsPerFrame = 0.0;
+    double UsedKBPerFrame = 0.0;
+  };
+
+  // !!! read-only engine counters, nothing is swapped while other threads
+  // !!! allocate; the call totals cover every thread, not just the game's
+  static auto ReadAllocations() -> uint64 {
+    return FMalloc::TotalMallocCalls.load(std::memory_order_relaxed)
+      + FMalloc::TotalReallocCalls.load(std::memory_order_relaxed);
+  }
+
+  // !!! drains the render thread and the game thread's queued tasks before
+  // !!! each reading so that little but the bench allocates in between;
+  // !!! background workers, e.g. async loading, can still add to the counts
+  static void Quiesce() {
+    FlushRenderingCommands();
+    FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+  }
+
+  static void DriveInput(AAlkCharacter & c, int const frame, int const index) {
+    auto const phase = (frame + index) % 60;
+    auto const touch = FVector(100.f + phase * 4.f, 200.f + phase * 2.f, 0.f);
+    // !!! mouse axis stream every frame
+    c.InputMouseAxis(1.f);
+    c.InputMouseAxis(-1.f);
+    // !!! touch press/drag/release sequence
+    if (phase == 0)
+      c.InputTouchPressed(ETouchIndex::Touch1, touch);
+    else if (phase < 20)
+      c.InputTouchDragged(ETouchIndex::Touch1, touch);
+    else if (phase == 20)
+      c.InputTouchReleased(ETouchIndex::Touch1, touch);
+    // !!! fire/hold bursts
+    else if (phase == 30 || phase == 34 || phase == 38)
+      c.InputFireOrHoldPressed();
+    else if (phase == 32 || phase == 36 || phase == 50)
+      c.InputFireOrHoldReleased();
+  }
+
+  static auto Run(
+    UWorld & world,
+    int const count,
+    int const frames,
+    bool const pickRay
+  ) -> Result {
+    Result result;
+    result.Characters = count;
+    result.Frames = frames;
+    TArray<AAlkCharacter*> characters;
+    FActorSpawnParameters params;
+    params.SpawnCollisionHandlingOverride =
+      ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    auto const side = FMath::Max(1, int(FMath::Sqrt(float(count))));
+    for (auto i = 0; i < count; ++i) {
+      auto const c = world.SpawnActor<AAlkCharacter>(
+        AAlkCharacter::StaticClass(),
+        FVector((i % side) * 200.f, (i / side) * 200.f, 200.f),
+        FRotator::ZeroRotator, params);
+      if (!c)
+        continue;
+      c->AlkPickRayTickEnabled = false; // !!! timed separately below
+      c->SetActorTickEnabled(false);    // !!! ticked by hand below
+      characters.Add(c);
+    }
+    auto const delta = 1.f / 60.f;
+    Quiesce();
+    auto const allocationsStart = ReadAllocations();
+    auto const usedStart = FPlatformMemory::GetStats().UsedPhysical;
+    uint64 tickCycles = 0, tickCyclesMax = 0, pickCycles = 0;
+    for (auto frame = 0; frame < frames; ++frame) {
+      for (auto i = 0; i < characters.Num(); ++i) {
+        auto & c = *characters[i];
+        auto const start = FPlatformTime::Cycles64();
+        DriveInput(c, frame, i);
+        c.Tick(delta);
+        c.AlkTickFeatures(delta);
+        auto const cycles = FPlatformTime::Cycles64() - start;
+        tickCycles += cycles;
+        tickCyclesMax = FMath::Max(tickCyclesMax, cycles);
+        if (pickRay) {
+          auto const pickStart = FPlatformTime::Cycles64();
+          FHitResult hitres;
+          c.AlkPickRayCameraHit(hitres);
+          c.AlkPickRayApplyTickHit(hitres);
+          pickCycles += FPlatformTime::Cycles64() - pickStart;
+        }
+      }
+    }
+    Quiesce();
+    auto const allocations = ReadAllocations() - allocationsStart;
+    auto const used = int64(FPlatformMemory::GetStats().UsedPhysical)
+      - int64(usedStart);
+    auto const samples = FMath::Max(1, characters.Num() * frames);
+    result.TickMicrosPerCharacter =
+      FPlatformTime::ToMilliseconds64(tickCycles) * 1000.0 / samples;
+    result.TickMicrosPerCharacterMax =
+      FPlatformTime::ToMilliseconds64(tickCyclesMax) * 1000.0;
+    result.PickRayMicrosPerCharacter =
+      FPlatformTime::ToMilliseconds64(pickCycles) * 1000.0 / samples;
+    result.AllocationsPerFrame = double(allocations) / FMath::Max(1, frames);
+    result.UsedKBPerFrame = double(used) / 1024.0 / FMath::Max(1, frames);
+    for (auto const c : characters)
+      c->Destroy();
+    return result;
+  }
+
+  static void Write(TArray<Result> const & results) {
+    auto const base = FPaths::Combine(FPaths::ProfilingDir(), TEXT("AlkBench"),
+      FDateTime::Now().ToString());
+    FString json = TEXT("[\n");
+    FString csv = TEXT("characters,frames,tick_us_per_char,tick_us_max,")
+                  TEXT("pickray_us_per_char,process_allocs_per_frame,process_used_kb_per_frame\n");
+    for (auto i = 0; i < results.Num(); ++i) {
+      auto const & r = results[i];
+      json += FString::Printf(
+        TEXT("  {\"characters\": %d, \"frames\": %d, \"tick_us_per_char\": %.3f, ")
+        TEXT("\"tick_us_max\": %.3f, \"pickray_us_per_char\": %.3f, ")
+        TEXT("\"process_allocs_per_frame\": %.1f, \"process_used_kb_per_frame\": %.3f}%s\n"),
+        r.Characters, r.Frames, r.TickMicrosPerCharacter,
+        r.TickMicrosPerCharacterMax, r.PickRayMicrosPerCharacter,
+        r.AllocationsPerFrame, r.UsedKBPerFrame,
+        i + 1 < results.Num() ? TEXT(",") : TEXT(""));
+      auto const line = FString::Printf(TEXT("%d,%d,%.3f,%.3f,%.3f,%.1f,%.3f"),
+        r.Characters, r.Frames, r.TickMicrosPerCharacter,
+        r.TickMicrosPerCharacterMax, r.PickRayMicrosPerCharacter,
+        r.AllocationsPerFrame, r.UsedKBPerFrame);
+      csv += line + TEXT("\n");
+      UE_LOG(LogAlkBench, Display, TEXT("%s"), *line);
+    }
+    json += TEXT("]\n");
+    FFileHelper::SaveStringToFile(json, *(base + TEXT(".json")));
+    FFileHelper::SaveStringToFile(csv,  *(base + TEXT(".csv")));
+    UE_LOG(LogAlkBench, Display,
+      TEXT("process_* columns count every thread, quiesced around each run"));
+    UE_LOG(LogAlkBench, Display, TEXT("results written to %s.{json,csv}"), *base);
+  }
+};
+
+static FAutoConsoleCommandWithWorldAndArgs AlkBenchCharactersCommand(
+  TEXT("alk.Bench.Characters"),
+  TEXT("alk.Bench.Characters <counts e.g. 1,10,100,1000> [frames] [pickray]"),
+  FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+    [](TArray<FString> const & args, UWorld * world) {
+      if (!world)
+        return;
+      TArray<FString> counts;
+      (args.Num() > 0 ? args[0] : FString(TEXT("1,10,100"))).ParseIntoArray(counts, TEXT(","));
+      auto const frames  = args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*args[1])) : 300;
+      auto const pickRay = args.Contains(TEXT("pickray"));
+      TArray<AlkCharacterBench::Result> results;
+      for (auto const & count : counts)
+        results.Add(AlkCharacterBench::Run(
+          *world, FMath::Clamp(FCString::Atoi(*count), 1, 1000), frames, pickRay));
+      AlkCharacterBench::Write(results);
+    }));
+
+#endif // !UE_BUILD_SHIPPING
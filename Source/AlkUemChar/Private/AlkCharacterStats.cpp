@@ -0,0 +1,30 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#include "AlkCharacterStats.h"
+
+DEFINE_STAT(STAT_AlkTick);
+DEFINE_STAT(STAT_AlkUpdateHMDState);
+DEFINE_STAT(STAT_AlkUpdateMouseState);
+DEFINE_STAT(STAT_AlkUpdateTouchState);
+DEFINE_STAT(STAT_AlkUpdateInputState);
+DEFINE_STAT(STAT_AlkInputMouseAxis);
+DEFINE_STAT(STAT_AlkScriptCall);
+DEFINE_STAT(STAT_AlkPickRayTrace);
+DEFINE_STAT(STAT_AlkOnShoot);
+DEFINE_STAT(STAT_AlkIntentValidate);
+
+DEFINE_STAT(STAT_AlkPickRayTraces);
+DEFINE_STAT(STAT_AlkPickRaySkips);
+DEFINE_STAT(STAT_AlkProjectilesSpawned);
+DEFINE_STAT(STAT_AlkProjectilesPooled);
+DEFINE_STAT(STAT_AlkProjectilesPrewarmed);
+DEFINE_STAT(STAT_AlkScriptCalls);
+DEFINE_STAT(STAT_AlkIntentsSent);
+DEFINE_STAT(STAT_AlkIntentBatches);
+DEFINE_STAT(STAT_AlkIntentsRejected);
+
+CSV_DEFINE_CATEGORY(AlkCharacter, true);
@@ -0,0 +1,53 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+// Per-frame cost of the plugin: "stat AlkCharacter" in game, the same
+// scopes as CPU events in Unreal Insights, and the AlkCharacter category
+// of CSV profiler captures (e.g. -csvCaptureFrames=600 on a server)
+//
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("AlkCharacter"), STATGROUP_AlkCharacter, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick"),           STAT_AlkTick,           STATGROUP_AlkCharacter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateHMDState"), STAT_AlkUpdateHMDState, STATGROUP_AlkCharacter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateMouseState"), STAT_AlkUpdateMouseState, STATGROUP_AlkCharacter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateTouchState"), STAT_AlkUpdateTouchState, STATGROUP_AlkCharacter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateInputState"), STAT_AlkUpdateInputState, STATGROUP_AlkCharacter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("InputMouseAxis"), STAT_AlkInputMouseAxis, STATGROUP_AlkCharacter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ScriptCall"),     STAT_AlkScriptCall,     STATGROUP_AlkCharacter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PickRayTrace"),   STAT_AlkPickRayTrace,   STATGROUP_AlkCharacter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnShoot"),        STAT_AlkOnShoot,        STATGROUP_AlkCharacter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("IntentValidate"), STAT_AlkIntentValidate, STATGROUP_AlkCharacter, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("PickRayTraces"),        STAT_AlkPickRayTraces,        STATGROUP_AlkCharacter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("PickRaySkips"),         STAT_AlkPickRaySkips,         STATGROUP_AlkCharacter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("ProjectilesSpawned"),   STAT_AlkProjectilesSpawned,   STATGROUP_AlkCharacter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("ProjectilesPooled"),    STAT_AlkProjectilesPooled,    STATGROUP_AlkCharacter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("ProjectilesPrewarmed"), STAT_AlkProjectilesPrewarmed, STATGROUP_AlkCharacter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("ScriptCalls"),          STAT_AlkScriptCalls,          STATGROUP_AlkCharacter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("IntentsSent"),          STAT_AlkIntentsSent,          STATGROUP_AlkCharacter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("IntentBatches"),        STAT_AlkIntentBatches,        STATGROUP_AlkCharacter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("IntentsRejected"),      STAT_AlkIntentsRejected,      STATGROUP_AlkCharacter, );
+
+CSV_DECLARE_CATEGORY_EXTERN(AlkCharacter);
+
+// !!! one scope feeds all three: stats, Insights and CSV
+#define ALK_STAT_SCOPE(Name) \
+  SCOPE_CYCLE_COUNTER(STAT_Alk##Name); \
+  TRACE_CPUPROFILER_EVENT_SCOPE(Alk##Name); \
+  CSV_SCOPED_TIMING_STAT(AlkCharacter, Name)
+
+#define ALK_STAT_COUNT(Name, Amount) \
+  do { \
+    INC_DWORD_STAT_BY(STAT_Alk##Name, Amount); \
+    CSV_CUSTOM_STAT(AlkCharacter, Name, int32(Amount), ECsvCustomStatOp::Accumulate); \
+  } while (0)
@@ -0,0 +1,140 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#include "AlkCharacterTimers.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+#include "AlkCharacter.h"
+#include "AlkCharacterStats.h"
+
+static int32 AlkTimersParallelMinimum = 4096;
+static FAutoConsoleVariableRef AlkTimersParallelMinimumCVar(
+  TEXT("alk.Timers.ParallelMinimum"),
+  AlkTimersParallelMinimum,
+  TEXT("AlkCharacter timer slots from which the batched pass uses ParallelFor"));
+
+constexpr int32 AlkTimersChunk = 1024; // !!! slots per ParallelFor task
+
+auto UAlkCharacterTimers::Register(
+  AAlkCharacter & character,
+  float const hmdSampleSeconds
+) -> int32 {
+  int32 slot;
+  if (FreeSlots.Num() > 0)
+    slot = FreeSlots.Pop(false);
+  else {
+    slot = Characters.AddDefaulted();
+    Flags.AddZeroed();
+    Events.AddZeroed();
+    FireSeconds.AddZeroed();
+    FireThresholdSeconds.AddZeroed();
+    HoldSeconds.AddZeroed();
+    HoldThresholdSeconds.AddZeroed();
+    HMDSeconds.AddZeroed();
+    HMDSampleSeconds.AddZeroed();
+  }
+  Characters[slot] = &character;
+  Flags[slot] = FLAG_ACTIVE;
+  Events[slot] = 0;
+  HMDSeconds[slot] = 0.f;
+  HMDSampleSeconds[slot] = FMath::Max(hmdSampleSeconds, HMDSampleMinimumSeconds);
+  return slot;
+}
+
+void UAlkCharacterTimers::Unregister(int32 const slot) {
+  if (!Flags.IsValidIndex(slot) || !Flags[slot])
+    return;
+  Characters[slot] = nullptr;
+  Flags[slot] = 0; // !!! holes are skipped by the pass, reused by Register
+  Events[slot] = 0;
+  FreeSlots.Add(slot);
+}
+
+void UAlkCharacterTimers::RestartFire(
+  int32 const slot,
+  float const thresholdSeconds
+) {
+  Flags[slot] |= FLAG_FIRE;
+  FireSeconds[slot] = 0.f;
+  FireThresholdSeconds[slot] = thresholdSeconds;
+}
+
+void UAlkCharacterTimers::StopFire(int32 const slot) {
+  Flags[slot] &= ~FLAG_FIRE;
+}
+
+void UAlkCharacterTimers::RestartHold(
+  int32 const slot,
+  float const thresholdSeconds
+) {
+  Flags[slot] |= FLAG_HOLD;
+  HoldSeconds[slot] = 0.f;
+  HoldThresholdSeconds[slot] = thresholdSeconds;
+}
+
+void UAlkCharacterTimers::StopHold(int32 const slot) {
+  Flags[slot] &= ~FLAG_HOLD;
+}
+
+void UAlkCharacterTimers::Tick(float DeltaTime) {
+  ALK_STAT_SCOPE(UpdateInputState);
+  auto const count = Flags.Num();
+  // !!! pure arithmetic over the arrays, no UObject is touched here
+  auto const advance = [this, DeltaTime](int32 const begin, int32 const end) {
+    for (auto i = begin; i < end; ++i) {
+      auto flags = Flags[i];
+      if (!flags)
+        continue;
+      uint8 events = 0;
+      if (flags & FLAG_FIRE) {
+        FireSeconds[i] += DeltaTime;
+        if (FireSeconds[i] >= FireThresholdSeconds[i]) {
+          flags &= ~FLAG_FIRE;
+          events |= EVENT_FIRE_RAPID_STOP;
+        }
+      }
+      if (flags & FLAG_HOLD) {
+        HoldSeconds[i] += DeltaTime;
+        if (HoldSeconds[i] >= HoldThresholdSeconds[i]) {
+          flags &= ~FLAG_HOLD; // !!! entered once per measurement
+          events |= EVENT_HOLD_ENTER;
+        }
+      }
+      HMDSeconds[i] += DeltaTime;
+      if (HMDSeconds[i] >= HMDSampleSeconds[i])
+        events |= EVENT_HMD_SAMPLE;
+      Flags[i] = flags;
+      Events[i] = events;
+    }
+  };
+  if (count >= AlkTimersParallelMinimum)
+    ParallelFor((count + AlkTimersChunk - 1) / AlkTimersChunk,
+      [&advance, count](int32 const chunk) {
+        advance(chunk * AlkTimersChunk,
+          FMath::Min(count, (chunk + 1) * AlkTimersChunk));
+      });
+  else
+    advance(0, count);
+  // !!! callbacks stay on the game thread and only for fired thresholds
+  for (auto i = 0; i < count; ++i) {
+    auto const events = Events[i];
+    if (!events)
+      continue;
+    Events[i] = 0;
+    auto const hmdSeconds = HMDSeconds[i];
+    if (events & EVENT_HMD_SAMPLE)
+      HMDSeconds[i] = 0.f;
+    auto const character = Characters[i].Get();
+    if (character)
+      character->AlkApplyBatchedTimerEvents(events, hmdSeconds);
+  }
+}
+
+auto UAlkCharacterTimers::GetStatId() const -> TStatId {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(UAlkCharacterTimers, STATGROUP_Tickables);
+}
@@ -0,0 +1,89 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#include "AlkHMDPresence.h"
+
+#include "HeadMountedDisplayFunctionLibrary.h"
+#include "Misc/CoreDelegates.h"
+
+struct AlkXRPoseSource : pure::HMDPoseSource {
+  virtual auto ReadPose(pure::HMDPose & outPose) -> bool override {
+    if (!UHeadMountedDisplayFunctionLibrary::IsHeadMountedDisplayEnabled())
+      return false;
+    UHeadMountedDisplayFunctionLibrary::GetOrientationAndPosition(
+      outPose.Orientation, outPose.Position);
+    return true;
+  }
+};
+
+AlkHMDPresence::~AlkHMDPresence() {
+  Stop();
+}
+
+void AlkHMDPresence::Start() {
+  if (!PoseSource)
+    PoseSource = MakeUnique<AlkXRPoseSource>();
+  if (bSimulated || PutOnHeadHandle.IsValid())
+    return;
+  // !!! formerly the disabled UVRNotificationsComponent in completeConstruction
+  PutOnHeadHandle = FCoreDelegates::VRHeadsetPutOnHead.AddRaw(
+    this, &AlkHMDPresence::OnPutOnHead);
+  RemovedFromHeadHandle = FCoreDelegates::VRHeadsetRemovedFromHead.AddRaw(
+    this, &AlkHMDPresence::OnRemovedFromHead);
+}
+
+void AlkHMDPresence::Stop() {
+  FCoreDelegates::VRHeadsetPutOnHead.Remove(PutOnHeadHandle);
+  FCoreDelegates::VRHeadsetRemovedFromHead.Remove(RemovedFromHeadHandle);
+  PutOnHeadHandle.Reset();
+  RemovedFromHeadHandle.Reset();
+}
+
+void AlkHMDPresence::Update(float const DeltaSeconds) {
+  if (bEventDriven)
+    return; // !!! no polling once the XR runtime notified us, for good
+  PendingSeconds += DeltaSeconds;
+  if (bApplied && PendingSeconds < SampleSeconds)
+    return;
+  pure::HMDPose pose;
+  auto const bHasPose = PoseSource && PoseSource->ReadPose(pose);
+  Detector.Update(bHasPose, pose, PendingSeconds);
+  PendingSeconds = 0.f;
+  if (!bApplied || Detector.bWorn != bWorn)
+    Apply(Detector.bWorn);
+}
+
+void AlkHMDPresence::SetPoseSource(TUniquePtr<pure::HMDPoseSource> source) {
+  Stop(); // !!! simulated poses must not race real XR notifications
+  PoseSource = MoveTemp(source);
+  Detector = pure::HMDMotionDetector{
+    Detector.NoiseFloorCm,
+    Detector.NoiseFloorDegrees,
+    Detector.UnwornAfterStillSeconds};
+  PendingSeconds = 0.f;
+  bApplied = false;
+  bEventDriven = false;
+  bSimulated = true;
+}
+
+void AlkHMDPresence::Apply(bool const worn) {
+  bApplied = true;
+  bWorn = worn;
+  if (OnWornChanged)
+    OnWornChanged(worn);
+}
+
+void AlkHMDPresence::OnPutOnHead() {
+  bEventDriven = true;
+  if (!bApplied || !bWorn)
+    Apply(true);
+}
+
+void AlkHMDPresence::OnRemovedFromHead() {
+  bEventDriven = true;
+  if (!bApplied || bWorn)
+    Apply(false);
+}
@@ -0,0 +1,49 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "AlkPureHMD.h"
+
+// !!! decides whether the HMD is worn: driven by XR put-on/removed
+// !!! notifications once the runtime proves it sends them, otherwise by
+// !!! sampling poses into a hysteresis motion detector
+// !!! the hand-off is one way: after the first notification the detector
+// !!! is no longer sampled for the rest of the session (until
+// !!! SetPoseSource), since a runtime that reports wearing once keeps
+// !!! reporting it and the detector would only second-guess its sensor
+struct AlkHMDPresence {
+  TFunction<void(bool const worn)> OnWornChanged;
+  pure::HMDMotionDetector Detector;
+  float SampleSeconds = 1.f;
+
+  ~AlkHMDPresence();
+
+  void Start();
+  void Stop();
+  void Update(float const DeltaSeconds);
+  void SetPoseSource(TUniquePtr<pure::HMDPoseSource> source);
+    // ^ !!! e.g. a pure::HMDSimulatedPoseSource for headless testing
+
+  auto IsEventDriven() const -> bool { return bEventDriven; }
+  auto IsWorn()        const -> bool { return bWorn; }
+
+private:
+  TUniquePtr<pure::HMDPoseSource> PoseSource;
+  FDelegateHandle PutOnHeadHandle;
+  FDelegateHandle RemovedFromHeadHandle;
+  float PendingSeconds = 0.f;
+  bool bApplied = false;
+  bool bEventDriven = false;
+  bool bSimulated = false;
+  bool bWorn = false;
+
+  void Apply(bool const worn);
+  void OnPutOnHead();
+  void OnRemovedFromHead();
+};
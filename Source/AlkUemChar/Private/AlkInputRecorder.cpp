@@ -0,0 +1,131 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#include "AlkInputRecorder.h"
+
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#include "AlkCharacter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAlkInput, Log, All);
+
+namespace alkinput {
+
+static auto operator<<(FArchive & ar, Event & e) -> FArchive & {
+  auto kind = uint8(e.Type);
+  ar << e.Frame << e.Seconds << kind << e.Finger << e.Value
+     << e.DeltaSeconds << e.Location << e.Mouse;
+  e.Type = Kind(kind);
+  return ar;
+}
+
+auto Recording::Save(FString const & path) const -> bool {
+  TArray<uint8> bytes;
+  FMemoryWriter writer(bytes);
+  auto magic = Magic;
+  auto version = Version;
+  auto size = ViewportSize;
+  auto count = int32(Events.Num());
+  writer << magic << version << size << count;
+  for (auto e : Events)
+    writer << e;
+  return FFileHelper::SaveArrayToFile(bytes, *path);
+}
+
+auto Recording::Load(FString const & path) -> bool {
+  TArray<uint8> bytes;
+  if (!FFileHelper::LoadFileToArray(bytes, *path))
+    return false;
+  FMemoryReader reader(bytes);
+  uint32 magic = 0, version = 0;
+  int32 count = 0;
+  reader << magic << version;
+  if (magic != Magic || version != Version)
+    return false;
+  reader << ViewportSize << count;
+  if (count < 0 || reader.IsError())
+    return false;
+  Events.SetNum(count);
+  for (auto & e : Events)
+    reader << e;
+  return !reader.IsError();
+}
+
+#if !UE_BUILD_SHIPPING
+
+static auto RecordingPath(TArray<FString> const & args, int const index) -> FString {
+  return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AlkInput"),
+    args.Num() > index ? args[index] : FString(TEXT("input.alkinput")));
+}
+
+static auto FirstLocalCharacter(UWorld * world) -> AAlkCharacter * {
+  if (world)
+    for (TActorIterator<AAlkCharacter> it(world); it; ++it)
+      if (it->IsLocallyControlled())
+        return *it;
+  return nullptr;
+}
+
+static FAutoConsoleCommandWithWorldAndArgs RecordCommand(
+  TEXT("alk.Input.Record"),
+  TEXT("alk.Input.Record start|stop [file] records the local AAlkCharacter input under Saved/AlkInput"),
+  FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+    [](TArray<FString> const & args, UWorld * world) {
+      auto const character = FirstLocalCharacter(world);
+      if (!character || args.Num() == 0)
+        return;
+      if (args[0] == TEXT("start"))
+        character->AlkInputRecordingStart();
+      else {
+        auto const path = RecordingPath(args, 1);
+        UE_LOG(LogAlkInput, Display, TEXT("recording %s %s"), *path,
+          character->AlkInputRecordingStop(path) ? TEXT("saved") : TEXT("FAILED"));
+      }
+    }));
+
+static FAutoConsoleCommandWithWorldAndArgs ReplayCommand(
+  TEXT("alk.Input.Replay"),
+  TEXT("alk.Input.Replay [file] [iterations] replays into a headless AAlkCharacter at full speed"),
+  FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+    [](TArray<FString> const & args, UWorld * world) {
+      if (!world)
+        return;
+      Recording recording;
+      auto const path = RecordingPath(args, 0);
+      if (!recording.Load(path)) {
+        UE_LOG(LogAlkInput, Warning, TEXT("cannot load recording %s"), *path);
+        return;
+      }
+      auto const iterations = args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*args[1])) : 1;
+      FActorSpawnParameters params;
+      params.SpawnCollisionHandlingOverride =
+        ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+      for (auto i = 0; i < iterations; ++i) {
+        auto const character = world->SpawnActor<AAlkCharacter>(
+          AAlkCharacter::StaticClass(), FTransform::Identity, params);
+        if (!character)
+          return;
+        character->SetActorTickEnabled(false); // !!! driven by the replay only
+        auto const start = FPlatformTime::Cycles64();
+        auto const checksum = character->AlkInputReplay(recording);
+        UE_LOG(LogAlkInput, Display,
+          TEXT("replay %d of %s: %d events in %.3f ms, checksum %08x"),
+          i + 1, *path, recording.Events.Num(),
+          FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - start),
+          checksum); // !!! identical across runs when deterministic
+        character->Destroy();
+      }
+    }));
+
+#endif // !UE_BUILD_SHIPPING
+
+}; // end namespace alkinput
@@ -0,0 +1,66 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace alkinput {
+
+// !!! one per bound input callback of AAlkCharacter, plus Frame per tick
+enum class Kind : uint8 {
+  Frame,                  // Value is DeltaSeconds
+  FireOrHoldPressed,
+  FireOrHoldReleased,
+  RecenterXR,
+  MoveForward,
+  MoveRight,
+  TurnRate,
+  LookRate,
+  MouseMovingDisable,
+  MouseMovingEnable,
+  MouseTurningDisable,
+  MouseTurningEnable,
+  MouseAxis,
+  SnapMoveBackward,
+  SnapMoveForward,
+  SnapMoveLeft,
+  SnapMoveRight,
+  SnapTurnBack,
+  SnapTurnLeft,
+  SnapTurnRight,
+  ToggleAutoForward,
+  TouchDragged,
+  TouchPressed,
+  TouchReleased,
+  Look,
+  Turn,
+  JumpPressed,
+  JumpReleased,
+};
+
+struct Event {
+  uint32    Frame   = 0;
+  float     Seconds = 0.f;    // !!! world real time when received
+  Kind      Type    = Kind::Frame;
+  uint8     Finger  = 0;
+  float     Value   = 0.f;
+  float     DeltaSeconds = 0.f; // !!! world delta the callback scaled by
+  FVector2f Location = FVector2f::ZeroVector; // !!! touch location
+  FVector2f Mouse    = FVector2f::ZeroVector; // !!! viewport mouse position
+};
+
+struct Recording {
+  static constexpr uint32 Magic   = 0x494b4c41; // "ALKI"
+  static constexpr uint32 Version = 2; // !!! 2 added DeltaSeconds
+  FVector2f ViewportSize = FVector2f::ZeroVector;
+  TArray<Event> Events;
+
+  auto Save(FString const & path) const -> bool;
+  auto Load(FString const & path) -> bool;
+};
+
+}; // end namespace alkinput
@@ -0,0 +1,219 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#include "AlkIntents.h"
+
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameStateBase.h"
+#include "HAL/IConsoleManager.h"
+
+#include "AlkCharacter.h"
+#include "AlkCharacterStats.h"
+#include "AlkPickable.h"
+#include "AlkTrace.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAlkIntents, Log, All);
+
+auto UAlkIntentValidator::Register(AAlkCharacter & character) -> int32 {
+  auto const slot = FreeSlots.Num() > 0
+    ? FreeSlots.Pop(false)
+    : Shooters.AddDefaulted();
+  auto & shooter = Shooters[slot];
+  shooter.Character = &character;
+  shooter.History.Reset();
+  shooter.HistoryFirst = 0;
+  shooter.bActive = true;
+  return slot;
+}
+
+void UAlkIntentValidator::Unregister(int32 const slot) {
+  if (!Shooters.IsValidIndex(slot) || !Shooters[slot].bActive)
+    return;
+  Shooters[slot].Character = nullptr;
+  Shooters[slot].bActive = false; // !!! reused by Register
+  FreeSlots.Add(slot);
+}
+
+void UAlkIntentValidator::Queue(
+  int32 const slot,
+  TArray<FAlkIntent> const & intents
+) {
+  ++Totals.Batches;
+  for (auto const & intent : intents)
+    Queued.Add({slot, intent});
+}
+
+void UAlkIntentValidator::Record(
+  Shooter & shooter,
+  double const now,
+  double const window
+) {
+  shooter.History.Add({now, shooter.Character->GetActorLocation()});
+  // !!! keeps one sample at or before the window start to lerp from,
+  // !!! so the history covers the window whatever the frame rate
+  auto const start = now - window;
+  while (   shooter.HistoryFirst + 1 < shooter.History.Num()
+         && shooter.History[shooter.HistoryFirst + 1].Seconds <= start)
+    ++shooter.HistoryFirst;
+  if (   shooter.HistoryFirst >= 64
+      && shooter.HistoryFirst * 2 >= shooter.History.Num()) {
+    shooter.History.RemoveAt(0, shooter.HistoryFirst, false);
+    shooter.HistoryFirst = 0;
+  }
+}
+
+auto UAlkIntentValidator::RewoundLocation(
+  Shooter const & shooter,
+  double const seconds,
+  FVector & location
+) -> bool {
+  auto const last = shooter.History.Num() - 1;
+  if (last < shooter.HistoryFirst)
+    return false;
+  auto const & history = shooter.History;
+  if (seconds >= history[last].Seconds) {
+    location = history[last].Location; // !!! client clock slightly ahead
+    return true;
+  }
+  for (auto n = last - 1; n >= shooter.HistoryFirst; --n) {
+    auto const & older = history[n];
+    if (older.Seconds > seconds)
+      continue;
+    auto const & newer = history[n + 1];
+    auto const span = newer.Seconds - older.Seconds;
+    location = FMath::Lerp(older.Location, newer.Location,
+      span > 0. ? (seconds - older.Seconds) / span : 1.);
+    return true;
+  }
+  return false; // !!! older than the whole history
+}
+
+void UAlkIntentValidator::Tick(float DeltaTime) {
+  auto const world = GetWorld();
+  if (!world)
+    return;
+  auto const now = world->GetTimeSeconds();
+  // !!! one pose sample per character per frame is the rewind history
+  for (auto & shooter : Shooters) {
+    auto const character = shooter.bActive ? shooter.Character.Get() : nullptr;
+    if (character)
+      Record(shooter, now, character->AlkIntentRewindSeconds);
+  }
+  if (Queued.Num() == 0)
+    return;
+  // !!! every intent received this frame is validated in this one pass
+  ALK_STAT_SCOPE(IntentValidate);
+  for (auto const & queued : Queued) {
+    auto const shooter = Shooters.IsValidIndex(queued.Slot)
+      ? &Shooters[queued.Slot]
+      : nullptr;
+    auto const character = shooter && shooter->bActive
+      ? shooter->Character.Get()
+      : nullptr;
+    if (!character)
+      continue; // !!! left the world since
+    auto const & intent = queued.Intent;
+    FCollisionQueryParams const params(
+      SCENE_QUERY_STAT(AlkIntent), false, character); // !!! ignore self
+    FVector rewound;
+    uint8 reject = 0;
+    if (   (FMath::Abs(now - intent.ServerSeconds)
+            > character->AlkIntentRewindSeconds)
+        || !RewoundLocation(*shooter, intent.ServerSeconds, rewound))
+      reject = REJECT_STALE;
+    else if (FVector::DistSquared(rewound, intent.Origin)
+             > FMath::Square(character->AlkIntentOriginToleranceCm))
+      reject = REJECT_ORIGIN;
+    else if (world->LineTraceTestByChannel(
+               rewound, intent.Origin, ECC_Visibility, params))
+      reject = REJECT_OCCLUDED;
+    if (reject) {
+      ++Totals.Rejected[reject];
+      ALK_STAT_COUNT(IntentsRejected, 1);
+      ALK_TRACE(*character, CategoryNet, IntentRejected,
+        int(intent.Kind), reject);
+      continue;
+    }
+    ++Totals.Accepted;
+    ALK_TRACE(*character, CategoryNet, IntentAccepted, int(intent.Kind));
+    FHitResult hitres;
+    if (intent.Kind == EAlkIntentKind::Pick) {
+      auto const registry = character->bAlkPickRayUseRegistry
+        ? world->GetSubsystem<UAlkPickableRegistry>()
+        : nullptr;
+      if (registry)
+        registry->Pick(intent.Origin, intent.Direction,
+          character->AlkPickRange, character->AlkPickConeDegrees,
+          character->AlkPickGazeRadius, hitres);
+      else
+        world->LineTraceSingleByChannel(hitres, intent.Origin,
+          intent.Origin + (intent.Direction * character->AlkPickRange),
+          ECC_Visibility, // !!! same as TraceTypeQuery1 in AlkPickRayHit
+          params);
+    }
+    character->AlkApplyValidatedIntent(intent, hitres);
+  }
+  Queued.Reset();
+}
+
+auto UAlkIntentValidator::GetStatId() const -> TStatId {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(UAlkIntentValidator, STATGROUP_Tickables);
+}
+
+#if !UE_BUILD_SHIPPING
+
+static FAutoConsoleCommandWithWorldAndArgs AlkIntentsProbeCommand(
+  TEXT("alk.Intents.Probe"),
+  TEXT("alk.Intents.Probe on a client sends one valid intent and one per rejection reason to the server"),
+  FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+    [](TArray<FString> const & args, UWorld * world) {
+      AAlkCharacter * character = nullptr;
+      if (world)
+        for (TActorIterator<AAlkCharacter> it(world); it; ++it)
+          if (it->IsLocallyControlled() && !it->HasAuthority()) {
+            character = *it;
+            break;
+          }
+      if (!character || !character->bAlkReplicatedIntents) {
+        UE_LOG(LogAlkIntents, Warning,
+          TEXT("needs a client possessing an AAlkCharacter with bAlkReplicatedIntents"));
+        return;
+      }
+      auto const state = world->GetGameState();
+      auto const now = state
+        ? state->GetServerWorldTimeSeconds()
+        : world->GetTimeSeconds();
+      auto const location = character->GetActorLocation();
+      auto const capsule = character->GetCapsuleComponent();
+      auto const below = capsule
+        ? capsule->GetScaledCapsuleHalfHeight() + 50.f
+        : 140.f;
+      auto const make = [&](FVector const & origin, double const seconds) {
+        FAlkIntent intent;
+        intent.Kind = EAlkIntentKind::Pick;
+        intent.Origin = origin;
+        intent.Direction = character->GetActorForwardVector();
+        intent.ServerSeconds = seconds;
+        return intent;
+      };
+      TArray<FAlkIntent> intents;
+      intents.Add(make(location, now)); // !!! accepted
+      intents.Add(make(location,
+        now - 4. * character->AlkIntentRewindSeconds - 1.)); // !!! STALE
+      intents.Add(make(location + FVector(0.f, 0.f,
+        2.f * character->AlkIntentOriginToleranceCm + 100.f), now)); // !!! ORIGIN
+      intents.Add(make(location - FVector(0.f, 0.f, below), now));
+        // ^ !!! OCCLUDED when standing on geometry, under the floor
+      character->ServerAlkIntents(intents);
+      UE_LOG(LogAlkIntents, Display,
+        TEXT("sent %d probe intents: expect accepted, rejected %d, %d, %d"),
+        intents.Num(), UAlkIntentValidator::REJECT_STALE,
+        UAlkIntentValidator::REJECT_ORIGIN, UAlkIntentValidator::REJECT_OCCLUDED);
+    }));
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,65 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#include "AlkPickRaySubsystem.h"
+
+#include "Engine/World.h"
+
+#include "AlkCharacter.h"
+#include "AlkCharacterStats.h"
+
+void UAlkPickRaySubsystem::QueuePickRay(
+  AAlkCharacter & character,
+  FVector const & start,
+  FVector const & end,
+  EAlkPointer const pointer
+) {
+  Requests.Add({&character, start, end, pointer});
+}
+
+void UAlkPickRaySubsystem::Tick(float DeltaTime) {
+  auto const world = GetWorld();
+  if (!world)
+    return;
+  // !!! results of the previous frame's submission are valid this frame
+  for (auto const & inflight : InFlight) {
+    auto const character = inflight.Character.Get();
+    if (!character)
+      continue;
+    FTraceDatum datum;
+    if (!world->QueryTraceData(inflight.Handle, datum))
+      continue;
+    FHitResult hitres;
+    for (auto const & hit : datum.OutHits)
+      if (hit.bBlockingHit) {
+        hitres = hit;
+        break;
+      }
+    character->AlkPickRayApplyPointerHit(inflight.Pointer, hitres);
+  }
+  InFlight.Reset();
+  // !!! all requests of this frame land in the same async trace batch
+  ALK_STAT_SCOPE(PickRayTrace);
+  ALK_STAT_COUNT(PickRayTraces, Requests.Num());
+  for (auto const & request : Requests) {
+    auto const character = request.Character.Get();
+    if (!character)
+      continue;
+    FCollisionQueryParams params(
+      SCENE_QUERY_STAT(AlkPickRay), false, character); // !!! ignore self
+    InFlight.Add({request.Character, request.Pointer,
+      world->AsyncLineTraceByChannel(
+        EAsyncTraceType::Single,
+        request.Start, request.End,
+        ECC_Visibility, // !!! same as TraceTypeQuery1 in the sync path
+        params)});
+  }
+  Requests.Reset();
+}
+
+auto UAlkPickRaySubsystem::GetStatId() const -> TStatId {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(UAlkPickRaySubsystem, STATGROUP_Tickables);
+}
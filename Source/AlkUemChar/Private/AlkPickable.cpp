@@ -0,0 +1,180 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#include "AlkPickable.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+#include "AlkCharacterStats.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAlkPickable, Log, All);
+
+auto UAlkPickableComponent::GetPickPrimitive() const -> UPrimitiveComponent * {
+  return PickPrimitive.Get();
+}
+
+void UAlkPickableComponent::OnRegister() {
+  Super::OnRegister();
+  auto const owner = GetOwner();
+  auto primitive = owner
+    ? Cast<UPrimitiveComponent>(owner->GetRootComponent())
+    : nullptr;
+  if (!primitive && owner)
+    primitive = owner->FindComponentByClass<UPrimitiveComponent>();
+  auto const world = GetWorld();
+  auto const registry = world ? world->GetSubsystem<UAlkPickableRegistry>() : nullptr;
+  if (!primitive || !registry) {
+    UE_LOG(LogAlkPickable, Warning,
+      TEXT("%s not pickable: %s"), *GetFullName(),
+      !primitive ? TEXT("owner has no primitive component")
+                 : TEXT("world has no pickable registry"));
+    return;
+  }
+  PickPrimitive = primitive;
+  MovedHandle = primitive->TransformUpdated.AddUObject(
+    this, &UAlkPickableComponent::OnPickPrimitiveMoved);
+  registry->Add(*this);
+}
+
+void UAlkPickableComponent::OnUnregister() {
+  if (auto const primitive = PickPrimitive.Get())
+    primitive->TransformUpdated.Remove(MovedHandle);
+  auto const world = GetWorld();
+  auto const registry = world ? world->GetSubsystem<UAlkPickableRegistry>() : nullptr;
+  if (registry)
+    registry->Remove(*this);
+  PickPrimitive = nullptr;
+  Super::OnUnregister();
+}
+
+void UAlkPickableComponent::OnPickPrimitiveMoved(
+  USceneComponent *,
+  EUpdateTransformFlags,
+  ETeleportType
+) {
+  auto const world = GetWorld();
+  auto const registry = world ? world->GetSubsystem<UAlkPickableRegistry>() : nullptr;
+  if (registry)
+    registry->Update(*this);
+}
+
+static auto MakePickableElement(
+  UAlkPickableComponent & pickable
+) -> FAlkPickableElement {
+  FAlkPickableElement element;
+  element.Pickable = &pickable;
+  auto const primitive = pickable.GetPickPrimitive();
+  if (primitive) {
+    auto const & bounds = primitive->Bounds;
+    element.Center = bounds.Origin;
+    element.Radius = bounds.SphereRadius + pickable.AlkPickPaddingCm;
+    element.Bounds = FBoxCenterAndExtent(
+      bounds.Origin, FVector(element.Radius));
+  }
+  return element;
+}
+
+void UAlkPickableRegistry::Add(UAlkPickableComponent & pickable) {
+  if (pickable.OctreeId.IsValidId())
+    return;
+  Octree.AddElement(MakePickableElement(pickable));
+  ++Count;
+}
+
+void UAlkPickableRegistry::Update(UAlkPickableComponent & pickable) {
+  if (!pickable.OctreeId.IsValidId())
+    return;
+  // !!! incremental: only this element leaves and re-enters its node
+  Octree.RemoveElement(pickable.OctreeId);
+  pickable.OctreeId = FOctreeElementId2();
+  Octree.AddElement(MakePickableElement(pickable));
+}
+
+void UAlkPickableRegistry::Remove(UAlkPickableComponent & pickable) {
+  if (!pickable.OctreeId.IsValidId())
+    return;
+  Octree.RemoveElement(pickable.OctreeId);
+  pickable.OctreeId = FOctreeElementId2();
+  --Count;
+}
+
+auto UAlkPickableRegistry::Pick(
+  FVector const & start,
+  FVector const & direction,
+  float const range,
+  float const coneDegrees,
+  float const gazeRadius,
+  FHitResult & outHit
+) const -> bool {
+  ALK_STAT_SCOPE(PickRayTrace);
+  if (Count == 0)
+    return false;
+  auto const dir = direction.GetSafeNormal();
+  auto const end = start + dir * range;
+  auto const coneTan = FMath::Tan(FMath::DegreesToRadians(
+    FMath::Clamp(coneDegrees, 0.f, 89.f)));
+  auto const widest = gazeRadius + coneTan * range;
+  struct Candidate {
+    FAlkPickableElement const * Element;
+    float Score;  // !!! 0 dead center, 1 at the edge of the allowance
+    float Along;
+    bool bOnRay;  // !!! the ray itself passes through the bounding sphere
+  };
+  TArray<Candidate, TInlineAllocator<32>> candidates;
+  auto query = FBox(start, start);
+  query += end;
+  Octree.FindElementsWithBoundsTest(
+    FBoxCenterAndExtent(query.ExpandBy(widest)),
+    [&](FAlkPickableElement const & element) {
+      auto const toCenter = element.Center - start;
+      auto const along = FVector::DotProduct(toCenter, dir);
+      if (along < -element.Radius || along > range + element.Radius)
+        return;
+      auto const across = (toCenter - dir * along).Size();
+      auto const allowance =
+        element.Radius + gazeRadius + coneTan * FMath::Max(0.f, along);
+      if (across <= allowance)
+        candidates.Add({&element, across / allowance, along,
+          across <= element.Radius});
+    });
+  // !!! real intersections nearest first, so nothing is picked through
+  // !!! what the ray hits; cone and gaze only rank the near misses
+  candidates.Sort([](Candidate const & a, Candidate const & b) {
+    if (a.bOnRay != b.bOnRay)
+      return a.bOnRay;
+    if (a.bOnRay)
+      return a.Along < b.Along;
+    return a.Score != b.Score ? a.Score < b.Score : a.Along < b.Along;
+  });
+  for (auto const & candidate : candidates) {
+    auto const pickable = candidate.Element->Pickable;
+    auto const primitive = pickable->GetPickPrimitive();
+    if (!primitive)
+      continue;
+    if (pickable->bAlkPickPrecise) {
+      // !!! physics only against this one primitive, along the real ray
+      FHitResult precise;
+      if (   candidate.bOnRay
+          && primitive->LineTraceComponent(precise, start, end,
+               FCollisionQueryParams(SCENE_QUERY_STAT(AlkPickPrecise), false))) {
+        outHit = precise;
+        return true;
+      }
+      continue;
+    }
+    auto const location = start + dir * FMath::Max(0.f, candidate.Along);
+    outHit = FHitResult(primitive->GetOwner(), primitive,
+      location, -dir);
+    outHit.TraceStart = start;
+    outHit.TraceEnd = end;
+    outHit.Distance = FMath::Max(0.f, candidate.Along);
+    outHit.bBlockingHit = true;
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,225 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#include "AlkProjectilePool.h"
+
+#include "Engine/World.h"
+#include "GameFramework/MovementComponent.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "TimerManager.h"
+
+#include "AlkCharacterStats.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAlkProjectilePool, Log, All);
+
+void UAlkProjectilePool::Prewarm(
+  TSubclassOf<AActor> projectileClass,
+  int const count
+) {
+  if (!projectileClass)
+    return;
+  auto & pool = Pools.FindOrAdd(projectileClass);
+  PruneIdle(pool); // !!! externally destroyed ones no longer count
+  while (pool.Idle.Num() + pool.InFlight < count) {
+    auto const projectile = SpawnIdle(projectileClass);
+    if (!projectile)
+      break; // TODO: @@@ LOG FAILURE
+    ALK_STAT_COUNT(ProjectilesPrewarmed, 1); // !!! ahead of play, not a shot
+    pool.Idle.Add(projectile);
+  }
+}
+
+auto UAlkProjectilePool::Acquire(
+  TSubclassOf<AActor> projectileClass,
+  FVector const & location,
+  FRotator const & rotation,
+  AActor * owner,
+  APawn * instigator
+) -> AActor * {
+  if (!projectileClass)
+    return nullptr;
+  auto & pool = Pools.FindOrAdd(projectileClass);
+  AActor * projectile = nullptr;
+  while (!projectile && pool.Idle.Num() > 0)
+    projectile = pool.Idle.Pop(false).Get(); // !!! skip externally destroyed
+  if (!projectile) {
+    projectile = SpawnIdle(projectileClass);
+    if (projectile)
+      ALK_STAT_COUNT(ProjectilesSpawned, 1); // !!! pool ran dry
+  }
+  else
+    ALK_STAT_COUNT(ProjectilesPooled, 1);
+  if (!projectile)
+    return nullptr;
+  pool.HighWaterMark = FMath::Max(pool.HighWaterMark, ++pool.InFlight);
+  auto & expiry = InFlightActors.Add(projectile);
+  auto const lifeSpan = projectileClass->GetDefaultObject<AActor>()->InitialLifeSpan;
+  if (lifeSpan > 0.f) // !!! as SetLifeSpan would, without destroying
+    GetWorld()->GetTimerManager().SetTimer(expiry,
+      FTimerDelegate::CreateUObject(this,
+        &UAlkProjectilePool::OnProjectileExpired,
+        TWeakObjectPtr<AActor>(projectile)),
+      lifeSpan, false);
+  projectile->SetOwner(owner);
+  projectile->SetInstigator(instigator);
+  projectile->SetActorLocationAndRotation(
+    location, rotation, false, nullptr, ETeleportType::ResetPhysics);
+    // ^ !!! placed as is, no AdjustIfPossibleButDontSpawnIfColliding
+  Activate(*projectile, rotation);
+  IAlkPooledProjectile::Execute_AlkOnProjectileAcquired(
+    projectile, location, rotation);
+  return projectile;
+}
+
+void UAlkProjectilePool::AlkReleaseProjectile(
+  UObject const * WorldContextObject,
+  AActor * Projectile
+) {
+  if (!Projectile)
+    return;
+  auto const world = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+  auto const self  = world ? world->GetSubsystem<UAlkProjectilePool>() : nullptr;
+  if (self && self->Pooled.Contains(Projectile))
+    self->Release(*Projectile);
+  else
+    Projectile->Destroy();
+}
+
+int UAlkProjectilePool::AlkPoolHighWaterMark(
+  TSubclassOf<AActor> ProjectileClass
+) const {
+  auto const pool = Pools.Find(ProjectileClass);
+  return pool ? pool->HighWaterMark : 0;
+}
+
+void UAlkProjectilePool::Release(AActor & projectile) {
+  auto const pool = Pools.Find(projectile.GetClass());
+  FTimerHandle expiry;
+  if (!pool || !InFlightActors.RemoveAndCopyValue(&projectile, expiry)) {
+    UE_LOG(LogAlkProjectilePool, Verbose,
+      TEXT("%s released while not in flight, ignored"),
+      *projectile.GetName()); // !!! e.g. hit, then expired in one frame
+    return;
+  }
+  ClearExpiry(expiry);
+  Deactivate(projectile);
+  IAlkPooledProjectile::Execute_AlkOnProjectileReleased(&projectile);
+  pool->Idle.Add(&projectile);
+  --pool->InFlight;
+}
+
+void UAlkProjectilePool::OnProjectileDestroyed(AActor * projectile) {
+  Pooled.Remove(projectile);
+  FTimerHandle expiry;
+  if (!InFlightActors.RemoveAndCopyValue(projectile, expiry))
+    return; // !!! an idle one, skipped by Acquire once its weak ptr is stale
+  ClearExpiry(expiry);
+  if (auto const pool = Pools.Find(projectile->GetClass()))
+    --pool->InFlight;
+}
+
+void UAlkProjectilePool::OnProjectileExpired(
+  TWeakObjectPtr<AActor> projectile
+) {
+  if (auto const expired = projectile.Get())
+    Release(*expired); // !!! in place of LifeSpanExpired's Destroy
+}
+
+void UAlkProjectilePool::ClearExpiry(FTimerHandle & expiry) const {
+  auto const world = GetWorld();
+  if (world && expiry.IsValid())
+    world->GetTimerManager().ClearTimer(expiry);
+}
+
+void UAlkProjectilePool::LogHighWaterMarks() const {
+  for (auto const & entry : Pools) {
+    auto idle = 0;
+    for (auto const & projectile : entry.Value.Idle)
+      idle += projectile.IsValid() ? 1 : 0; // !!! const, so counted not pruned
+    UE_LOG(LogAlkProjectilePool, Log,
+      TEXT("%s: high-water mark %d, spawned %d, idle %d"),
+      *GetNameSafe(entry.Key.Get()),
+      entry.Value.HighWaterMark, entry.Value.Spawned, idle);
+  }
+}
+
+void UAlkProjectilePool::Deinitialize() {
+  LogHighWaterMarks(); // !!! size pools from real sessions
+  for (auto & entry : InFlightActors)
+    ClearExpiry(entry.Value);
+  Pools.Empty();
+  Pooled.Empty();
+  InFlightActors.Empty();
+  Super::Deinitialize();
+}
+
+auto UAlkProjectilePool::PruneIdle(ClassPool & pool) -> int {
+  pool.Idle.RemoveAllSwap([](TWeakObjectPtr<AActor> const & projectile) {
+    return !projectile.IsValid();
+  });
+  return pool.Idle.Num();
+}
+
+auto UAlkProjectilePool::SpawnIdle(
+  TSubclassOf<AActor> projectileClass
+) -> AActor * {
+  auto const world = GetWorld();
+  if (!world)
+    return nullptr;
+  if (!projectileClass->ImplementsInterface(UAlkPooledProjectile::StaticClass()))
+    return nullptr; // !!! cannot be recycled, caller spawns it the old way
+  FActorSpawnParameters params;
+  params.SpawnCollisionHandlingOverride =
+    ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+  params.bDeferConstruction = false;
+  auto const projectile = world->SpawnActor<AActor>(
+    projectileClass, FVector::ZeroVector, FRotator::ZeroRotator, params);
+  if (!projectile)
+    return nullptr;
+  Deactivate(*projectile);
+  projectile->OnDestroyed.AddDynamic(
+    this, &UAlkProjectilePool::OnProjectileDestroyed);
+  Pooled.Add(projectile);
+  ++Pools.FindOrAdd(projectileClass).Spawned;
+  return projectile;
+}
+
+void UAlkProjectilePool::Activate(
+  AActor & projectile,
+  FRotator const & rotation
+) {
+  projectile.SetActorHiddenInGame(false);
+  projectile.SetActorEnableCollision(true);
+  projectile.SetActorTickEnabled(true);
+  for (auto const component : projectile.GetComponents()) {
+    if (!component)
+      continue;
+    if (component->PrimaryComponentTick.bStartWithTickEnabled)
+      component->SetComponentTickEnabled(true);
+    if (auto const movement = Cast<UProjectileMovementComponent>(component)) {
+      // !!! only InitializeComponent sets it, once, on the first spawn
+      movement->Velocity = rotation.Vector() * movement->InitialSpeed;
+      movement->UpdateComponentVelocity();
+    }
+  }
+}
+
+void UAlkProjectilePool::Deactivate(AActor & projectile) {
+  projectile.SetActorHiddenInGame(true);
+  projectile.SetActorEnableCollision(false);
+  projectile.SetActorTickEnabled(false);
+  projectile.SetLifeSpan(0.f);
+    // ^ !!! InitialLifeSpan would destroy it while idle; pooled
+    // !!! projectiles expire through AlkReleaseProjectile instead
+  for (auto const component : projectile.GetComponents()) {
+    if (!component)
+      continue;
+    component->SetComponentTickEnabled(false); // !!! e.g. movement simulation
+    if (auto const movement = Cast<UMovementComponent>(component))
+      movement->StopMovementImmediately();
+  }
+}
@@ -0,0 +1,164 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#include "AlkTrace.h"
+
+#include <atomic>
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDeviceRedirector.h"
+#include "Misc/Paths.h"
+#if ALK_TRACE_INSIGHTS
+#include "ProfilingDebugging/MiscTrace.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogAlkTrace, Log, All);
+
+#if ALK_TRACE_LEVEL > 0
+
+namespace alktrace {
+
+int32 Mask = ~0;
+
+static FAutoConsoleVariableRef MaskCVar(
+  TEXT("alk.Trace.Mask"), Mask,
+  TEXT("AlkCharacter trace categories: 1 input, 2 drag, 4 viewport, 8 HMD, 16 fire, 32 net"));
+
+constexpr uint32 RingCapacity = 4096; // !!! power of two
+static Record Ring[RingCapacity];
+static std::atomic<uint32> RingHead{0};
+
+static TCHAR const * const EventNames[] = {
+  TEXT("HMDWorn"),
+  TEXT("HMDNotWorn"),
+  TEXT("ViewportSize"),
+  TEXT("InputFireOrHoldPressed"),
+  TEXT("InputFireOrHoldReleased"),
+  TEXT("InputMouseMovingDisable"),
+  TEXT("InputMouseMovingEnable"),
+  TEXT("InputMouseTurningDisable"),
+  TEXT("InputMouseTurningEnable"),
+  TEXT("InputTouchPressed"),
+  TEXT("InputTouchReleased"),
+  TEXT("DragMoveByViewportDelta"),
+  TEXT("DragTurnByViewportDelta"),
+  TEXT("OnFire"),
+  TEXT("OnShoot"),
+  TEXT("SnapMove"),
+  TEXT("SnapMoveRejected"),
+  TEXT("IntentBatchSent"),
+  TEXT("IntentRejected"),
+  TEXT("IntentAccepted"),
+};
+static_assert(UE_ARRAY_COUNT(EventNames) == int(Event::Count),
+  "EventNames must match alktrace::Event");
+
+void Emit(
+  Event const id, uint32 const ownerId,
+  float const a0, float const a1, float const a2,
+  float const a3, float const a4, float const a5
+) {
+  // !!! lock-free: producers claim distinct slots, oldest get overwritten
+  auto const index = RingHead.fetch_add(1, std::memory_order_relaxed);
+  auto & record = Ring[index & (RingCapacity - 1)];
+  record.Cycles  = FPlatformTime::Cycles64();
+  record.Frame   = uint32(GFrameCounter);
+  record.OwnerId = ownerId;
+  record.Id      = id;
+  record.Args[0] = a0; record.Args[1] = a1; record.Args[2] = a2;
+  record.Args[3] = a3; record.Args[4] = a4; record.Args[5] = a5;
+#if ALK_TRACE_INSIGHTS
+  TRACE_BOOKMARK(TEXT("AlkTrace %s"), EventNames[int(id)]);
+#endif
+}
+
+static auto Format(Record const & r) -> FString {
+  auto const & a = r.Args;
+  FString args;
+  switch (r.Id) {
+    case Event::ViewportSize:
+      args = FString::Printf(TEXT("viewport size %f x %f"), a[0], a[1]);
+      break;
+    case Event::InputTouchPressed:
+    case Event::InputTouchReleased:
+      args = FString::Printf(TEXT("finger %d at (%f,%f)"), int(a[0]), a[1], a[2]);
+      break;
+    case Event::DragMoveByViewportDelta:
+      args = FString::Printf(TEXT("((%f,%f)): vpRatio (%f,%f), meters (%f,%f)"),
+        a[0], a[1], a[2], a[3], a[4], a[5]);
+      break;
+    case Event::DragTurnByViewportDelta:
+      args = FString::Printf(TEXT("((%f,%f)): vpRatio (%f,%f), degrees (%f,%f)"),
+        a[0], a[1], a[2], a[3], a[4], a[5]);
+      break;
+    case Event::OnFire:
+      args = FString::Printf(TEXT("at (%f,%f) rapid %d"), a[0], a[1], int(a[2]));
+      break;
+    case Event::SnapMove:
+      args = FString::Printf(TEXT("direction %d to (%f,%f,%f)"),
+        int(a[0]), a[1], a[2], a[3]);
+      break;
+    case Event::SnapMoveRejected:
+      args = FString::Printf(TEXT("direction %d"), int(a[0]));
+      break;
+    case Event::IntentBatchSent:
+      args = FString::Printf(TEXT("%d intents"), int(a[0]));
+      break;
+    case Event::IntentRejected:
+      args = FString::Printf(TEXT("kind %d reason %d"), int(a[0]), int(a[1]));
+      break;
+    case Event::IntentAccepted:
+      args = FString::Printf(TEXT("kind %d"), int(a[0]));
+      break;
+    default:
+      break;
+  }
+  return FString::Printf(TEXT("%.6f frame %u owner %u %s %s"),
+    FPlatformTime::ToSeconds64(r.Cycles), r.Frame, r.OwnerId,
+    int(r.Id) < int(Event::Count) ? EventNames[int(r.Id)] : TEXT("?"),
+    *args);
+}
+
+template <typename F>
+static void ForEachRecord(F && func) {
+  auto const head  = RingHead.load(std::memory_order_acquire);
+  auto const count = FMath::Min(head, RingCapacity);
+  for (auto i = head - count; i != head; ++i)
+    func(Ring[i & (RingCapacity - 1)]);
+}
+
+void Dump(FOutputDevice & out) {
+  ForEachRecord([&out](Record const & r) {
+    out.Log(LogAlkTrace.GetCategoryName(), ELogVerbosity::Log, Format(r));
+  });
+}
+
+auto DumpToFile(FString const & path) -> bool {
+  TArray<FString> lines;
+  ForEachRecord([&lines](Record const & r) { lines.Add(Format(r)); });
+  return FFileHelper::SaveStringArrayToFile(lines, *path);
+}
+
+static FAutoConsoleCommand DumpCommand(
+  TEXT("alk.Trace.Dump"),
+  TEXT("Formats the AlkCharacter trace ring buffer to the log, or to a file under Saved/Logs when named"),
+  FConsoleCommandWithArgsDelegate::CreateLambda([](TArray<FString> const & args) {
+    if (args.Num() == 0)
+      Dump(*GLog);
+    else {
+      auto const path = FPaths::Combine(FPaths::ProjectLogDir(), args[0]);
+      if (DumpToFile(path))
+        UE_LOG(LogAlkTrace, Log, TEXT("trace dumped to %s"), *path);
+      else
+        UE_LOG(LogAlkTrace, Warning, TEXT("trace dump to %s failed"), *path);
+    }
+  }));
+
+}; // end namespace alktrace
+
+#endif // ALK_TRACE_LEVEL > 0
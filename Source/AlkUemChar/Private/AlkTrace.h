@@ -0,0 +1,88 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#pragma once
+
+#include "CoreMinimal.h"
+
+// !!! 0 strips every ALK_TRACE, 1 records into the ring buffer
+#ifndef ALK_TRACE_LEVEL
+#  if UE_BUILD_SHIPPING
+#    define ALK_TRACE_LEVEL 0
+#  else
+#    define ALK_TRACE_LEVEL 1
+#  endif
+#endif
+
+// !!! 1 also emits an Unreal Insights bookmark per record
+#ifndef ALK_TRACE_INSIGHTS
+#  define ALK_TRACE_INSIGHTS 0
+#endif
+
+namespace alktrace {
+
+enum Category : int32 {
+  CategoryInput    = 1 << 0,
+  CategoryDrag     = 1 << 1,
+  CategoryViewport = 1 << 2,
+  CategoryHMD      = 1 << 3,
+  CategoryFire     = 1 << 4,
+  CategoryNet      = 1 << 5,
+};
+
+enum class Event : uint16 {
+  HMDWorn,
+  HMDNotWorn,
+  ViewportSize,             // width, height
+  InputFireOrHoldPressed,
+  InputFireOrHoldReleased,
+  InputMouseMovingDisable,
+  InputMouseMovingEnable,
+  InputMouseTurningDisable,
+  InputMouseTurningEnable,
+  InputTouchPressed,        // finger, x, y
+  InputTouchReleased,       // finger, x, y
+  DragMoveByViewportDelta,  // delta x y, ratio x y, meters x y
+  DragTurnByViewportDelta,  // delta x y, ratio x y, degrees x y
+  OnFire,                   // x, y, rapid count
+  OnShoot,
+  SnapMove,                 // direction, x, y, z
+  SnapMoveRejected,         // direction
+  IntentBatchSent,          // intents
+  IntentRejected,           // kind, reason
+  IntentAccepted,           // kind
+  Count
+};
+
+// !!! binary only, formatted when dumped
+struct Record {
+  uint64 Cycles;
+  uint32 Frame;
+  uint32 OwnerId;           // !!! UObject unique id
+  Event  Id;
+  float  Args[6];
+};
+
+extern int32 Mask; // !!! runtime category mask, cvar alk.Trace.Mask
+
+void Emit(Event const id, uint32 const ownerId,
+  float const a0 = 0.f, float const a1 = 0.f, float const a2 = 0.f,
+  float const a3 = 0.f, float const a4 = 0.f, float const a5 = 0.f);
+
+void Dump(FOutputDevice & out);
+auto DumpToFile(FString const & path) -> bool;
+
+}; // end namespace alktrace
+
+#if ALK_TRACE_LEVEL > 0
+#define ALK_TRACE(owner, category, event, ...) \
+  do { \
+    if ((alktrace::Mask & alktrace::category) && (owner).AlkTracing) \
+      alktrace::Emit(alktrace::Event::event, (owner).GetUniqueID(), ##__VA_ARGS__); \
+  } while (0)
+#else
+#define ALK_TRACE(owner, category, event, ...) do {} while (0)
+#endif
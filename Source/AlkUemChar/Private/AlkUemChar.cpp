@@ -7,4 +7,14 @@
 #include "AlkUemChar.h"
 #include "Modules/ModuleManager.h"
 
-IMPLEMENT_GAME_MODULE(FDefaultGameModuleImpl, AlkUemChar);
+#include "AlkCharScript.h"
+
+void FAlkUemCharModule::StartupModule() {
+  alkchar::ScriptCacheStartup();
+}
+
+void FAlkUemCharModule::ShutdownModule() {
+  alkchar::ScriptCacheShutdown();
+}
+
+IMPLEMENT_GAME_MODULE(FAlkUemCharModule, AlkUemChar);
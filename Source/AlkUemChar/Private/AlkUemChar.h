@@ -7,3 +7,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Modules/ModuleInterface.h"
+
+class FAlkUemCharModule : public IModuleInterface {
+public:
+  virtual void StartupModule()  override; // IModuleInterface::
+  virtual void ShutdownModule() override; // IModuleInterface::
+};
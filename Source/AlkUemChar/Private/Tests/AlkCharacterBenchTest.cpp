@@ -0,0 +1,68 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+// Headless, e.g. in CI
+//   UnrealEditor-Cmd Game.uproject -nullrhi -unattended
+//     -ExecCmds="Automation RunTests Alk.Char.Bench; Quit"
+// then collect Saved/Profiling/AlkBench/*.csv
+//
+#include "AlkCharacter.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include "AlkTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+
+auto BenchResults() -> TSet<FString> {
+  TArray<FString> files;
+  IFileManager::Get().FindFiles(files,
+    *FPaths::Combine(FPaths::ProfilingDir(), TEXT("AlkBench"), TEXT("*.csv")),
+    true, false);
+  return TSet<FString>(files);
+}
+
+}; // end anonymous namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlkCharacterBenchTest,
+  "Alk.Char.Bench.Characters",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+auto FAlkCharacterBenchTest::RunTest(FString const & Parameters) -> bool {
+  AlkTestWorld test;
+  auto const before = BenchResults();
+  // !!! short enough for every CI run, alk.Bench.Characters for real numbers
+  IConsoleManager::Get().ProcessUserConsoleInput(
+    TEXT("alk.Bench.Characters 1,10,100 60 pickray"), *GLog, test.World);
+  auto const after = BenchResults().Difference(before);
+  if (!TestEqual(TEXT("one new result"), after.Num(), 1))
+    return false;
+  FString csv;
+  FFileHelper::LoadFileToString(csv, *FPaths::Combine(
+    FPaths::ProfilingDir(), TEXT("AlkBench"), *after.Array()[0]));
+  TArray<FString> lines;
+  csv.ParseIntoArrayLines(lines);
+  if (!TestEqual(TEXT("a header and a row per count"), lines.Num(), 4))
+    return false;
+  for (auto i = 1; i < lines.Num(); ++i) {
+    TArray<FString> columns;
+    lines[i].ParseIntoArray(columns, TEXT(","));
+    if (!TestEqual(TEXT("columns"), columns.Num(), 7))
+      continue;
+    TestTrue(FString::Printf(TEXT("%s characters ticked"), *columns[0]),
+      FCString::Atod(*columns[2]) > 0.0);
+  }
+  AddInfo(csv); // !!! in the automation report as well
+  return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,329 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+// Quantization and rewind run headless; the listen server with two
+// clients in one process needs the editor, e.g.
+//   UnrealEditor-Cmd Game.uproject -nullrhi -unattended
+//     -ExecCmds="Automation RunTests Alk.Char.Intents; Quit"
+//
+#include "AlkCharacter.h"
+
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+#include "UObject/CoreNet.h"
+
+#include "AlkIntents.h"
+#include "AlkTestWorld.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "Settings/LevelEditorPlaySettings.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+
+template<typename Quantized>
+auto NetRoundTrip(Quantized value) -> Quantized { // !!! NetSerialize is not const
+  FNetBitWriter writer(nullptr, 1024);
+  bool bSuccess = true;
+  value.NetSerialize(writer, nullptr, bSuccess);
+  FNetBitReader reader(nullptr, writer.GetData(), writer.GetNumBits());
+  Quantized result;
+  result.NetSerialize(reader, nullptr, bSuccess);
+  return result;
+}
+
+auto MakeIntent(
+  FVector const & origin,
+  double const seconds,
+  FVector const & direction = FVector::ForwardVector
+) -> FAlkIntent {
+  FAlkIntent intent;
+  intent.Kind = EAlkIntentKind::Pick;
+  intent.Pointer = uint8(EAlkPointer::Camera);
+  intent.Origin = origin;
+  intent.Direction = direction;
+  intent.ServerSeconds = seconds;
+  return intent;
+}
+
+auto Delta(
+  UAlkIntentValidator::Counts const & after,
+  UAlkIntentValidator::Counts const & before
+) -> UAlkIntentValidator::Counts {
+  UAlkIntentValidator::Counts delta;
+  delta.Batches = after.Batches - before.Batches;
+  delta.Accepted = after.Accepted - before.Accepted;
+  for (auto i = 0; i < UE_ARRAY_COUNT(delta.Rejected); ++i)
+    delta.Rejected[i] = after.Rejected[i] - before.Rejected[i];
+  return delta;
+}
+
+}; // end anonymous namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlkIntentsQuantizationTest,
+  "Alk.Char.Intents.Quantization",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+auto FAlkIntentsQuantizationTest::RunTest(FString const & Parameters) -> bool {
+  // !!! what the server validates is what survived the wire
+  for (auto const & origin : {
+         FVector(0.0), FVector(123.456, -7890.123, 45.678),
+         FVector(-99999.97, 250000.04, -0.05)}) {
+    auto const intent = MakeIntent(origin, 0.);
+    auto const received = NetRoundTrip(intent.Origin);
+    TestTrue(FString::Printf(TEXT("origin %s within 0.05 cm"), *origin.ToString()),
+      received.Equals(intent.Origin, 0.05 + KINDA_SMALL_NUMBER));
+  }
+  for (auto const & direction : {
+         FVector::ForwardVector, FVector(1.0, 2.0, -3.0).GetSafeNormal(),
+         FVector(-0.3, 0.0, 0.95).GetSafeNormal()}) {
+    auto const intent = MakeIntent(FVector::ZeroVector, 0., direction);
+    auto const received = NetRoundTrip(intent.Direction);
+    TestTrue(FString::Printf(TEXT("direction %s"), *direction.ToString()),
+      received.Equals(intent.Direction, 1e-4));
+  }
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlkIntentsRewindTest,
+  "Alk.Char.Intents.Rewind",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+auto FAlkIntentsRewindTest::RunTest(FString const & Parameters) -> bool {
+  AlkTestWorld test;
+  auto const character = AlkTestWorld::Spawn<AAlkCharacter>(*test.World,
+    FVector::ZeroVector, [](AAlkCharacter & c) {
+      c.bAlkReplicatedIntents = true; // !!! read by BeginPlay
+      c.AlkIntentRewindSeconds = 1.f;
+    });
+  auto const validator = test.World->GetSubsystem<UAlkIntentValidator>();
+  if (   !TestNotNull(TEXT("character spawned"), character)
+      || !TestNotNull(TEXT("validator"), validator))
+    return false;
+  character->GetCharacterMovement()->SetComponentTickEnabled(false);
+    // ^ !!! no floor here, the steps below are the only motion
+  // !!! a second of 20 cm steps, the validator samples once per frame
+  auto const delta = 1.f / 60.f;
+  TArray<double> seconds;
+  TArray<FVector> locations;
+  for (auto frame = 0; frame < 60; ++frame) {
+    character->SetActorLocation(FVector(20.0 * frame, 0.0, 100.0));
+    test.World->Tick(LEVELTICK_All, delta);
+    seconds.Add(test.World->GetTimeSeconds());
+    locations.Add(character->GetActorLocation());
+  }
+  auto const now = test.World->GetTimeSeconds();
+  auto const then = 30; // !!! half a second ago, 600 cm behind
+  TArray<FAlkIntent> intents;
+  intents.Add(MakeIntent(locations[then], seconds[then]));   // !!! rewound
+  intents.Add(MakeIntent(locations[then], now));             // !!! ORIGIN
+  intents.Add(MakeIntent(locations.Last(), now - 5.));       // !!! STALE
+  intents.Add(MakeIntent(locations.Last(), now + 5.));       // !!! STALE
+  auto const before = validator->GetCounts();
+  character->ServerAlkIntents(intents); // !!! standalone, runs in place
+  test.World->Tick(LEVELTICK_All, delta);
+  auto const counts = Delta(validator->GetCounts(), before);
+  TestEqual(TEXT("one batch"), counts.Batches, 1u);
+  TestEqual(TEXT("the rewound origin is accepted"), counts.Accepted, 1u);
+  TestEqual(TEXT("the present is too far from that origin"),
+    counts.Rejected[UAlkIntentValidator::REJECT_ORIGIN], 1u);
+  TestEqual(TEXT("outside the rewind window"),
+    counts.Rejected[UAlkIntentValidator::REJECT_STALE], 2u);
+  return true;
+}
+
+#if WITH_EDITOR
+
+namespace {
+
+// !!! a PIE listen server with the host's player and two clients, all
+// !!! in this process; the clients possess spawned AAlkCharacters
+struct PIESession {
+  TWeakObjectPtr<UWorld> Server;
+  TWeakObjectPtr<UWorld> Clients[2];
+  TWeakObjectPtr<AAlkCharacter> Owned[2]; // !!! client local pawns
+  TWeakObjectPtr<AAlkCharacter> ServerOwned[2]; // !!! their server copies
+  UAlkIntentValidator::Counts Before;
+  double Deadline = 0.;
+
+  void Arm(double const seconds) {
+    Deadline = FPlatformTime::Seconds() + seconds;
+  }
+  auto TimedOut(FAutomationTestBase & test, TCHAR const * const what) -> bool {
+    if (FPlatformTime::Seconds() < Deadline)
+      return false;
+    test.AddError(FString::Printf(TEXT("timed out waiting for %s"), what));
+    return true;
+  }
+  auto FindWorlds() -> bool {
+    auto clients = 0;
+    for (auto const & context : GEngine->GetWorldContexts()) {
+      auto const world = context.World();
+      if (context.WorldType != EWorldType::PIE || !world)
+        continue;
+      if (world->GetNetMode() == NM_ListenServer)
+        Server = world;
+      else if (world->GetNetMode() == NM_Client && clients < 2)
+        Clients[clients++] = world;
+    }
+    return Server.IsValid() && clients == 2;
+  }
+  auto Validator() const -> UAlkIntentValidator * {
+    return Server.IsValid()
+      ? Server->GetSubsystem<UAlkIntentValidator>()
+      : nullptr;
+  }
+};
+
+auto LocalPawn(UWorld * const world) -> AAlkCharacter * {
+  auto const pc = world ? world->GetFirstPlayerController() : nullptr;
+  return pc ? Cast<AAlkCharacter>(pc->GetPawn()) : nullptr;
+}
+
+auto Nearest(
+  UWorld * const world,
+  FVector const & location,
+  bool const bLocal
+) -> AAlkCharacter * {
+  AAlkCharacter * nearest = nullptr;
+  for (TActorIterator<AAlkCharacter> it(world); it; ++it)
+    if (   it->IsLocallyControlled() == bLocal
+        && (!nearest
+            || FVector::DistSquared(it->GetActorLocation(), location)
+               < FVector::DistSquared(nearest->GetActorLocation(), location)))
+      nearest = *it;
+  return nearest;
+}
+
+}; // end anonymous namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlkIntentsListenServerTest,
+  "Alk.Char.Intents.ListenServer",
+  EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+auto FAlkIntentsListenServerTest::RunTest(FString const & Parameters) -> bool {
+  FAutomationEditorCommonUtils::CreateNewMap();
+  auto const settings = NewObject<ULevelEditorPlaySettings>();
+  settings->SetPlayNetMode(EPlayNetMode::PIE_ListenServer);
+  settings->SetPlayNumberOfClients(3); // !!! the host's player and two clients
+  settings->SetRunUnderOneProcess(true);
+  FRequestPlaySessionParams params;
+  params.WorldType = EPlaySessionWorldType::PlayInEditor;
+  params.EditorPlaySettings = settings;
+  GEditor->RequestPlaySession(params);
+
+  auto const session = MakeShared<PIESession>();
+  session->Arm(30.);
+  ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, session]() {
+    if (!session->FindWorlds())
+      return session->TimedOut(*this, TEXT("the PIE worlds"));
+    // !!! possess one replicated-intent character per remote client
+    auto index = 0;
+    for (auto it = session->Server->GetPlayerControllerIterator(); it; ++it) {
+      auto const pc = it->Get();
+      if (!pc || pc->IsLocalController() || index >= 2)
+        continue;
+      auto const character = AlkTestWorld::Spawn<AAlkCharacter>(
+        *session->Server, FVector(0.0, 500.0 * (index + 1), 200.0),
+        [](AAlkCharacter & c) {
+          c.bAlkReplicatedIntents = true; // !!! read by BeginPlay
+          c.AlkPickRayTickEnabled = false; // !!! only the intents below
+        });
+      if (character)
+        pc->Possess(character);
+      session->ServerOwned[index++] = character;
+    }
+    session->Arm(10.);
+    return true;
+  }));
+  ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, session]() {
+    for (auto i = 0; i < 2; ++i) {
+      auto const pawn = LocalPawn(session->Clients[i].Get());
+      if (!pawn || pawn->GetLocalRole() != ROLE_AutonomousProxy)
+        return session->TimedOut(*this, TEXT("the clients to possess"));
+      pawn->bAlkReplicatedIntents = true; // !!! not replicated
+      pawn->AlkPickRayTickEnabled = false;
+      session->Owned[i] = pawn;
+    }
+    return true;
+  }));
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(0.5f)); // !!! drain stragglers
+  ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, session]() {
+    auto const validator = session->Validator();
+    auto const a = session->Owned[0].Get();
+    auto const serverA = a
+      ? Nearest(session->Server.Get(), a->GetActorLocation(), false)
+      : nullptr;
+    auto const serverB = session->Owned[1].IsValid()
+      ? Nearest(session->Server.Get(),
+          session->Owned[1]->GetActorLocation(), false)
+      : nullptr;
+    if (!validator || !a || !serverA || !serverB || serverA == serverB) {
+      AddError(TEXT("listen server session not set up"));
+      return true;
+    }
+    session->Before = validator->GetCounts();
+    // !!! batching: 40 in one frame are one full batch and one timed batch
+    auto const location = a->GetActorLocation();
+    for (auto i = 0; i < 40; ++i)
+      a->AlkQueueIntent(EAlkIntentKind::Pick, EAlkPointer::Camera,
+        location, a->GetActorForwardVector());
+    // !!! client-chosen values the server must reject, in one direct batch
+    auto const state = a->GetWorld()->GetGameState();
+    auto const now = state ? state->GetServerWorldTimeSeconds() : 0.;
+    a->ServerAlkIntents({
+      MakeIntent(location, now - 10.),                        // !!! STALE
+      MakeIntent(location + FVector(0.0, 0.0, 5000.0), now)}); // !!! ORIGIN
+    // !!! COND_SkipOwner: only B may see what the server sets on A
+    serverA->AlkPickTargets[int(EAlkPointer::Right)].Actor = serverB;
+    session->Arm(10.);
+    return true;
+  }));
+  ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, session]() {
+    auto const validator = session->Validator();
+    auto const a = session->Owned[0].Get();
+    auto const b = session->Owned[1].Get();
+    if (!validator || !a || !b)
+      return true; // !!! already reported
+    auto const counts = Delta(validator->GetCounts(), session->Before);
+    auto const replicaOfA = Nearest(b->GetWorld(), a->GetActorLocation(), false);
+    auto const replicated = replicaOfA
+      && replicaOfA->AlkPickTargets[int(EAlkPointer::Right)].Actor;
+    auto const settled = counts.Accepted >= 40
+      && counts.Rejected[UAlkIntentValidator::REJECT_STALE]
+       + counts.Rejected[UAlkIntentValidator::REJECT_ORIGIN] >= 2
+      && replicated;
+    if (!settled && !session->TimedOut(*this, TEXT("validation and replication")))
+      return false;
+    TestEqual(TEXT("40 intents in two batches plus the direct one"),
+      counts.Batches, 3u);
+    TestEqual(TEXT("every queued intent accepted"), counts.Accepted, 40u);
+    TestEqual(TEXT("stale rejected"),
+      counts.Rejected[UAlkIntentValidator::REJECT_STALE], 1u);
+    TestEqual(TEXT("far origin rejected"),
+      counts.Rejected[UAlkIntentValidator::REJECT_ORIGIN], 1u);
+    TestTrue(TEXT("the other client sees the pick target"), replicated);
+    TestNull(TEXT("the owner is skipped"),
+      a->AlkPickTargets[int(EAlkPointer::Right)].Actor.Get());
+    return true;
+  }));
+  ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand());
+  return true;
+}
+
+#endif // WITH_EDITOR
+
+#endif // WITH_DEV_AUTOMATION_TESTS
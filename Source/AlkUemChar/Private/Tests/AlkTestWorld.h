@@ -0,0 +1,55 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+// !!! an empty game world that has begun play, for headless automation
+// !!! tests that spawn characters without a map or a viewport
+struct AlkTestWorld {
+  UWorld * World = nullptr;
+
+  AlkTestWorld() {
+    World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("AlkTestWorld"));
+    auto & context = GEngine->CreateNewWorldContext(EWorldType::Game);
+    context.SetCurrentWorld(World);
+    World->InitializeActorsForPlay(FURL());
+    World->BeginPlay();
+  }
+  AlkTestWorld(AlkTestWorld const &) = delete;
+  auto operator=(AlkTestWorld const &) -> AlkTestWorld & = delete;
+
+  ~AlkTestWorld() {
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+  }
+
+  template<typename Actor>
+  auto Spawn(FVector const & location = FVector::ZeroVector) -> Actor * {
+    return Spawn<Actor>(*World, location, [](Actor &) {});
+  }
+
+  // !!! configure runs before BeginPlay, e.g. for properties it reads
+  template<typename Actor>
+  static auto Spawn(
+    UWorld & world,
+    FVector const & location,
+    TFunctionRef<void(Actor &)> const configure
+  ) -> Actor * {
+    FTransform const transform(location);
+    auto const actor = world.SpawnActorDeferred<Actor>(
+      Actor::StaticClass(), transform, nullptr, nullptr,
+      ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+    if (!actor)
+      return nullptr;
+    configure(*actor);
+    actor->FinishSpawning(transform);
+    return actor;
+  }
+};
@@ -11,8 +11,63 @@
 #include "CoreMinimal.h"
 #include "VRCharacter.h"
 
+#include "AlkIntents.h"
+#include "AlkTouchGesture.h"
+
 #include "AlkCharacter.generated.h"
 
+namespace alkinput { struct Recording; }
+namespace pure { struct HMDPoseSource; }
+
+// !!! the rays a character can pick along, as bit (1 << value) in a mask
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "false"))
+enum class EAlkPointer : uint8
+{
+  Camera,
+  Left,  // !!! LeftMotionController, only with bAlkUsingMotionControllers
+  Right, // !!! RightMotionController, only with bAlkUsingMotionControllers
+  Count UMETA(Hidden)
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FAlkPickRayTargetChanged,
+  class AAlkCharacter*, Character,
+  AActor*,              Actor, // !!! right-const * not supported by UHT
+  UPrimitiveComponent*, Component);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FAlkPickRayTargetChangedNative,
+  class AAlkCharacter &, AActor const *, UPrimitiveComponent const *);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FAlkPickRayPointerTargetChanged,
+  class AAlkCharacter*, Character,
+  EAlkPointer,          Pointer,
+  AActor*,              Actor,
+  UPrimitiveComponent*, Component);
+DECLARE_MULTICAST_DELEGATE_FourParams(FAlkPickRayPointerTargetChangedNative,
+  class AAlkCharacter &, EAlkPointer, AActor const *, UPrimitiveComponent const *);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FAlkHoldMovedNative,
+  class AAlkCharacter &, FVector const &, FVector const &);
+    // ^ !!! screen coordinates, then the viewport ratio delta since the
+    // !!! previous frame
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FAlkTouchGestureRecognized,
+  class AAlkCharacter*, Character,
+  EAlkTouchGesture,     Gesture,
+  int32,                Fingers,
+  FVector2D,            Value);
+DECLARE_MULTICAST_DELEGATE_FourParams(FAlkTouchGestureRecognizedNative,
+  class AAlkCharacter &, EAlkTouchGesture, int32, FVector2D const &);
+
+// !!! how one feature of AAlkCharacter ticks apart from the actor itself
+USTRUCT(BlueprintType)
+struct ALKUEMCHAR_API FAlkFeatureTick
+{
+  GENERATED_BODY()
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    bool bEnabled = true;
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    TEnumAsByte<ETickingGroup> TickGroup = TG_PrePhysics;
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float TickInterval = 0.f; // !!! seconds, 0 is every frame
+};
+
 UCLASS()
 class ALKUEMCHAR_API AAlkCharacter : public AVRCharacter
 {
@@ -26,16 +81,46 @@ public:
   static constexpr int OPTION_NO_JUMP    = 1 << 1;
   static constexpr int OPTION_NO_MOVE    = 1 << 2;
   static constexpr int OPTION_VR_3DOF    = 1 << 3;
+  static constexpr int OPTION_REMOTE_LITE = 1 << 4;
+    // ^ remote/AI profile: camera, boom, shoot nodes and touch state are
+    //   only created once a local player possesses the pawn
 
   auto HasAllOptions(int const inOptions) const -> bool;
   auto HasAnyOptions(int const inOptions) const -> bool;
 
   virtual void PostInitializeComponents() override; // APawn::
+#if WITH_EDITOR
+  virtual void PostEditChangeProperty(              // UObject::
+    FPropertyChangedEvent & PropertyChangedEvent) override;
+#endif
   virtual void SetupPlayerInputComponent(           // APawn::
     class UInputComponent*) override;
 
   virtual void BeginPlay()                    override; // AActor::
+  virtual void EndPlay(                             // AActor::
+    EEndPlayReason::Type const) override;
   virtual void Tick(float const DeltaSeconds) override; // AActor::
+  virtual void RegisterActorTickFunctions(bool bRegister) override; // AActor::
+  virtual void NotifyControllerChanged() override;          // APawn::
+  virtual void GetLifetimeReplicatedProps(                  // AActor::
+    TArray<FLifetimeProperty> & OutLifetimeProps) const override;
+
+  UFUNCTION(BlueprintCallable, Category = AlkCharacter)
+    void AlkRefreshScriptSubscriptions();
+      // ^ re-queries which per-frame script hooks are subscribed
+  UFUNCTION(BlueprintCallable, Category = AlkCharacter)
+    void AlkScriptSubscriptionChanged(FName Event, bool bSubscribed);
+      // ^ from alkchar.aboa when a listener subscribed or unsubscribed,
+      //   bSubscribed when any listener of Event remains
+  UFUNCTION(BlueprintCallable, Category = AlkCharacter)
+    void AlkApplyFeatureTicks();
+      // ^ re-registers the feature tick functions after AlkTick* changed
+
+  void AlkTickFeatures(float const DeltaSeconds);
+    // ^ runs every feature inline, for benchmarks, in the order the
+    //   registered ticks usually take: input, HMD (at AlkTickHMD
+    //   intervals), script, pick ray; the feature ticks themselves only
+    //   run while the actor tick is enabled
 
   // blueprintables
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
@@ -48,18 +133,48 @@ public:
     int AlkFireRapidLimit;
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = AlkCharacter)
     float AlkPickRange;
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkPickRayRetraceMinDistance; // !!! cm the camera must move
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkPickRayRetraceMinDegrees;  // !!! degrees the camera must turn
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkPickRayRetraceMaxSeconds;  // !!! retrace anyway for moving targets
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = AlkCharacter)
+    int AlkPickRayTickTraceCount;
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = AlkCharacter)
+    int AlkPickRayTickSkipCount;
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
     float AlkInputDragThresholdPixels;
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
     float AlkInputFireRapidThresholdSeconds;
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
     float AlkInputHoldThresholdSeconds;
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    TArray<FAlkTouchGestureBinding> AlkTouchGestures;
+      // ^ classified once per frame from all touch fingers together
+  UPROPERTY(BlueprintAssignable, Category = AlkCharacter)
+    FAlkTouchGestureRecognized AlkOnTouchGesture; // !!! Notify actions
+  FAlkTouchGestureRecognizedNative AlkOnTouchGestureNative;
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = AlkCharacter)
     float AlkLookRateDegPerSec;
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = AlkCharacter)
     float AlkTurnRateDegPerSec;
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category=AlkCharacter)
     float AlkTurnSnapDeg;
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkSnapMoveDistance; // !!! cm per snap move step
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkSnapMoveFadeSeconds; // !!! comfort fade out and in, 0 for none
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkSnapMoveToleranceCm;      // !!! drift a cached step survives
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkSnapMoveToleranceDegrees; // !!! turn a cached step survives
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkHMDNoiseFloorCm;      // !!! HMD motion below counts as still
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkHMDNoiseFloorDegrees; // !!! HMD rotation below counts as still
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkHMDUnwornAfterStillSeconds;
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
     bool AlkFirstPerson;
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
@@ -69,7 +184,49 @@ public:
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
     bool AlkPickRayTickEnabled;
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
-    bool AlkTracing;
+    bool bAlkPickRayUseRegistry;
+      // ^ !!! picks only UAlkPickableComponent owners via the world's
+      // !!! UAlkPickableRegistry instead of tracing the physics scene
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkPickConeDegrees; // !!! registry picks only, 0 for a plain ray
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkPickGazeRadius;  // !!! registry picks only, in cm
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    bool AlkPickRayTickAsync;
+      // ^ !!! traces the camera ray asynchronously, batched per world,
+      // !!! bypassing AlkPickRayCameraHit, and notifies one frame later
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter, meta = (Bitmask, BitmaskEnum = "/Script/AlkUemChar.EAlkPointer"))
+    int32 AlkPickRayTickPointers;
+      // ^ !!! pointers the tick pick ray follows, queried together;
+      // !!! only the camera by default
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    bool AlkTracing; // !!! records into the alk.Trace ring buffer, see AlkTrace.h
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    bool bAlkBatchedTimers;
+      // ^ !!! fire, hold and HMD timers advance in UAlkCharacterTimers
+      // !!! with every other such character, instead of per actor
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    bool bAlkReplicatedIntents;
+      // ^ !!! clients send shots and pick targets to the server as batched
+      // !!! intents instead of spawning locally; the server validates them
+      // !!! in UAlkIntentValidator, spawns the projectiles and replicates
+      // !!! the pick targets into AlkPickTargets
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkIntentBatchSeconds;      // !!! client send interval, 0 every frame
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkIntentRewindSeconds;     // !!! server accepts intents this old
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkIntentOriginToleranceCm; // !!! from the rewound actor location
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, ReplicatedUsing = AlkOnRepPickTargets, Category = AlkCharacter)
+    TArray<FAlkPickTarget> AlkPickTargets; // !!! indexed by EAlkPointer
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    FAlkFeatureTick AlkTickHMD;     // !!! HMD presence sampling
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    FAlkFeatureTick AlkTickInput;   // !!! mouse, touch and input timers
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    FAlkFeatureTick AlkTickScript;  // !!! the alkchar-tick dispatch
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    FAlkFeatureTick AlkTickPickRay; // !!! the pick rays of AlkPickRayTickPointers
 
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = AlkCharacter, meta = (AllowPrivateAccess = "true"))
     class USpringArmComponent* AlkFollowBoom;
@@ -88,8 +245,12 @@ public:
     void AlkOnHoldLeave(FVector const & ScreenCoordinates);
     virtual void AlkOnHoldLeave_Implementation(FVector const & ScreenCoordinates);
   UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = AlkCharacter)
-    void AlkOnHoldMove(FVector const & ScreenCoordinates);
-    virtual void AlkOnHoldMove_Implementation(FVector const & ScreenCoordinates);
+    void AlkOnHoldMove(FVector const & ScreenCoordinates, FVector const & Delta);
+    virtual void AlkOnHoldMove_Implementation(FVector const & ScreenCoordinates, FVector const & Delta);
+      // ^ at most once per frame, mouse and touch moves summed into Delta
+      //   as viewport ratios (pixels over the larger viewport side)
+  FAlkHoldMovedNative AlkOnHoldMoveNative;
+    // ^ !!! C++ listeners, before AlkOnHoldMove and without the Blueprint VM
 
 #if 0 // TODO: @@@ DEPRECATED, NOW PROVIDED BY AVRCharacter
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = AlkCharacter, meta = (AllowPrivateAccess = "true"))
@@ -107,6 +268,10 @@ public:
   // @@@ shoot specifics (optional)
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
     TSubclassOf<class AActor> AlkProjectileClass;
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    bool bAlkProjectilePooling; // !!! AlkProjectileClass must implement IAlkPooledProjectile
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    int AlkProjectilePoolPrewarm;
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
     class USoundBase* AlkShootSound;
   UPROPERTY(VisibleDefaultsOnly, Category = AlkCharacter)
@@ -151,15 +316,70 @@ public:
           bool AlkPickRayPointerHit(               FHitResult& OutHitResult);
   virtual bool AlkPickRayPointerHit_Implementation(FHitResult& OutHitResult);
 
+  UFUNCTION(BlueprintCallable, Category = AlkCharacter)
+    int32 AlkPickRayPointersHit(int32 Pointers, TArray<FHitResult>& OutHitResults);
+      // ^ picks along every pointer of the mask (bit 1 << EAlkPointer) in
+      //   one query; OutHitResults is indexed by EAlkPointer, returns the
+      //   mask of pointers that hit
+
   UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = AlkCharacter)
           void AlkPickRayTarget( // !!! note right-const * not supported UI header generation
                 const AActor * actor, const UPrimitiveComponent * component);
   virtual void AlkPickRayTarget_Implementation(
                 const AActor * actor, const UPrimitiveComponent * component);
+      // ^ calls the script if subscribed, after AlkPickRayApplyPointerHit()
+      //   broadcast to the delegates below
+
+  UPROPERTY(BlueprintAssignable, Category = AlkCharacter)
+    FAlkPickRayTargetChanged AlkOnPickRayTargetChanged;
+  FAlkPickRayTargetChangedNative AlkOnPickRayTargetChangedNative;
+    // ^ !!! C++ listeners, no Blueprint VM or script round-trip
+  UPROPERTY(BlueprintAssignable, Category = AlkCharacter)
+    FAlkPickRayPointerTargetChanged AlkOnPickRayPointerTargetChanged;
+  FAlkPickRayPointerTargetChangedNative AlkOnPickRayPointerTargetChangedNative;
+    // ^ !!! every pointer of AlkPickRayTickPointers, the camera included
+
+  void AlkSetHMDPoseSource(TUniquePtr<pure::HMDPoseSource> source);
+    // ^ replaces XR poses and notifications, e.g. with simulated poses
+
+  void AlkInputRecordingStart();
+  auto AlkInputRecordingStop(FString const & path) -> bool;
+  auto AlkInputReplay(alkinput::Recording const & recording) -> uint32;
+    // ^ feeds every recorded input callback and frame at full speed,
+    //   returns a checksum of the resulting input state machine only,
+    //   not of the pawn, camera or components the input moves
+
+  void AlkPickRayApplyTickHit(FHitResult const & hitres);
+    // ^ AlkPickRayApplyPointerHit() for EAlkPointer::Camera
+  void AlkPickRayApplyPointerHit(
+    EAlkPointer const pointer, FHitResult const & hitres);
+    // ^ notifies when that pointer's tick pick ray target changed,
+    //   then for the camera the AlkOnPickRayTargetChanged delegates and
+    //   AlkPickRayTarget()
+
+  void AlkApplyBatchedTimerEvents(uint8 const events, float const hmdSeconds);
+    // ^ from UAlkCharacterTimers when one of this character's timers fired
+
+  UFUNCTION(Server, Reliable, WithValidation)
+    void ServerAlkIntents(TArray<FAlkIntent> const & Intents);
+      // ^ one call per AlkIntentBatchSeconds carries every pending intent
+  void AlkQueueIntent(EAlkIntentKind const kind, EAlkPointer const pointer,
+    FVector const & origin, FVector const & direction);
+    // ^ batches an intent to ServerAlkIntents() as firing and picking do,
+    //   only on the owning client with bAlkReplicatedIntents
+  UFUNCTION()
+    void AlkOnRepPickTargets(TArray<FAlkPickTarget> const & Previous);
+      // ^ broadcasts AlkOnPickRayPointerTargetChanged on other clients
+
+  void AlkApplyValidatedIntent(
+    FAlkIntent const & intent, FHitResult const & hitres);
+    // ^ from UAlkIntentValidator on the server once an intent passed
 
   struct Impl { virtual ~Impl() = 0; };
 
 private:
+  friend struct AlkCharacterBench; // !!! drives the input bindings below
+
   void completeConstruction(int const inOptions);
 
   std::unique_ptr<struct Impl> impl;
@@ -168,9 +388,13 @@ private:
   void InputFireOrHoldPressed();
   void InputFireOrHoldReleased();
   void InputRecenterXR();
+  void InputJumpPressed();
+  void InputJumpReleased();
 
   void InputMoveForward(float const);
   void InputMoveRight(float const);
+  void InputLook(float const);
+  void InputTurn(float const);
   void InputTurnRate(float const);
   void InputLookRate(float const);
 
@@ -0,0 +1,57 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "AlkCharacterTimers.generated.h"
+
+// !!! advances the fire, hold and HMD timers of every AAlkCharacter with
+// !!! bAlkBatchedTimers in one pass over structure-of-arrays state, and
+// !!! calls back into a character only when one of its thresholds fires
+UCLASS()
+class ALKUEMCHAR_API UAlkCharacterTimers : public UTickableWorldSubsystem
+{
+  GENERATED_BODY()
+
+public:
+  static constexpr uint8 EVENT_FIRE_RAPID_STOP = 1 << 0;
+  static constexpr uint8 EVENT_HOLD_ENTER      = 1 << 1;
+  static constexpr uint8 EVENT_HMD_SAMPLE      = 1 << 2;
+
+  static constexpr float HMDSampleMinimumSeconds = 1.f / 30.f;
+    // ^ !!! AlkTickHMD.TickInterval 0 would call back every frame
+
+  auto Register(class AAlkCharacter & character, float hmdSampleSeconds)
+    -> int32; // !!! slot, stable until Unregister
+  void Unregister(int32 const slot);
+
+  void RestartFire(int32 const slot, float const thresholdSeconds);
+  void StopFire(int32 const slot);
+  void RestartHold(int32 const slot, float const thresholdSeconds);
+  void StopHold(int32 const slot);
+
+  virtual void Tick(float DeltaTime) override; // FTickableGameObject::
+  virtual auto GetStatId() const -> TStatId override;
+
+private:
+  static constexpr uint8 FLAG_ACTIVE = 1 << 0;
+  static constexpr uint8 FLAG_FIRE   = 1 << 1;
+  static constexpr uint8 FLAG_HOLD   = 1 << 2;
+
+  TArray<TWeakObjectPtr<class AAlkCharacter>> Characters;
+  TArray<uint8> Flags;
+  TArray<uint8> Events;
+  TArray<float> FireSeconds;
+  TArray<float> FireThresholdSeconds;
+  TArray<float> HoldSeconds;
+  TArray<float> HoldThresholdSeconds;
+  TArray<float> HMDSeconds;
+  TArray<float> HMDSampleSeconds;
+  TArray<int32> FreeSlots;
+};
@@ -0,0 +1,117 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "AlkIntents.generated.h"
+
+UENUM(BlueprintType)
+enum class EAlkIntentKind : uint8
+{
+  Shoot,
+  Pick,
+};
+
+// !!! what a client claims it did, sent to the server in batches
+USTRUCT(BlueprintType)
+struct ALKUEMCHAR_API FAlkIntent
+{
+  GENERATED_BODY()
+
+  UPROPERTY(BlueprintReadOnly, Category = AlkCharacter)
+    EAlkIntentKind Kind = EAlkIntentKind::Shoot;
+  UPROPERTY(BlueprintReadOnly, Category = AlkCharacter)
+    uint8 Pointer = 0; // !!! EAlkPointer
+  UPROPERTY(BlueprintReadOnly, Category = AlkCharacter)
+    FVector_NetQuantize10 Origin;      // !!! 0.1 cm
+  UPROPERTY(BlueprintReadOnly, Category = AlkCharacter)
+    FVector_NetQuantizeNormal Direction; // !!! 16 bits per component
+  UPROPERTY(BlueprintReadOnly, Category = AlkCharacter)
+    double ServerSeconds = 0.; // !!! server world time the client saw
+};
+
+// !!! one pointer's validated pick target, replicated to other clients
+USTRUCT(BlueprintType)
+struct ALKUEMCHAR_API FAlkPickTarget
+{
+  GENERATED_BODY()
+
+  UPROPERTY(BlueprintReadOnly, Category = AlkCharacter)
+    TObjectPtr<AActor> Actor;
+  UPROPERTY(BlueprintReadOnly, Category = AlkCharacter)
+    TObjectPtr<UPrimitiveComponent> Component;
+};
+
+// !!! on the server, keeps a short pose history of every AAlkCharacter
+// !!! with bAlkReplicatedIntents and validates all intents received
+// !!! during the frame in one batched trace pass, rewinding each
+// !!! character to when its client acted, within AlkIntentRewindSeconds
+//
+// !!! to exercise it, run a listen server and a client, e.g.
+// !!!   UnrealEditor <uproject> <map>?listen -game -log
+// !!!   UnrealEditor <uproject> 127.0.0.1 -game -log
+// !!! then alk.Intents.Probe on the client sends one intent that passes
+// !!! and one per REJECT_* reason through ServerAlkIntents, and
+// !!! alk.Trace.Dump on the server lists IntentAccepted/IntentRejected
+UCLASS()
+class ALKUEMCHAR_API UAlkIntentValidator : public UTickableWorldSubsystem
+{
+  GENERATED_BODY()
+
+public:
+  static constexpr int32 BatchMax = 32; // !!! intents per RPC
+
+  static constexpr uint8 REJECT_STALE      = 1; // !!! outside the rewind window
+  static constexpr uint8 REJECT_ORIGIN     = 2; // !!! too far from the pawn
+  static constexpr uint8 REJECT_OCCLUDED   = 3; // !!! origin behind geometry
+  static constexpr uint8 REJECT_UNKNOWN    = 4; // !!! character not registered
+
+  auto Register(class AAlkCharacter & character)
+    -> int32; // !!! slot, stable until Unregister
+  void Unregister(int32 const slot);
+
+  void Queue(int32 const slot, TArray<FAlkIntent> const & intents);
+
+  struct Counts { // !!! since the world began, e.g. for automation tests
+    uint32 Batches = 0;
+    uint32 Accepted = 0;
+    uint32 Rejected[REJECT_UNKNOWN + 1] = {}; // !!! indexed by REJECT_*
+  };
+  auto GetCounts() const -> Counts const & { return Totals; }
+
+  virtual void Tick(float DeltaTime) override; // FTickableGameObject::
+  virtual auto GetStatId() const -> TStatId override;
+
+private:
+  struct PoseSample {
+    double Seconds = 0.;
+    FVector Location = FVector::ZeroVector;
+  };
+  struct Shooter {
+    TWeakObjectPtr<class AAlkCharacter> Character;
+    TArray<PoseSample> History; // !!! oldest first, pruned by time
+    int32 HistoryFirst = 0;     // !!! samples before it are stale
+    bool bActive = false;
+  };
+  struct QueuedIntent {
+    int32 Slot;
+    FAlkIntent Intent;
+  };
+
+  static void Record(Shooter & shooter, double const now,
+    double const window);
+  static auto RewoundLocation(Shooter const & shooter, double const seconds,
+    FVector & location) -> bool;
+
+  TArray<Shooter> Shooters;
+  TArray<int32> FreeSlots;
+  TArray<QueuedIntent> Queued;
+  Counts Totals;
+};
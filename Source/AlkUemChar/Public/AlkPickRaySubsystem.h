@@ -0,0 +1,49 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+
+#include "AlkPickRaySubsystem.generated.h"
+
+enum class EAlkPointer : uint8;
+
+// !!! gathers the pick rays of every AAlkCharacter in a world during the
+// !!! frame, submits them together through the engine async trace API,
+// !!! and hands the results back to each character on the next frame
+UCLASS()
+class ALKUEMCHAR_API UAlkPickRaySubsystem : public UTickableWorldSubsystem
+{
+  GENERATED_BODY()
+
+public:
+  void QueuePickRay(
+    class AAlkCharacter & character,
+    FVector const & start,
+    FVector const & end,
+    EAlkPointer const pointer);
+
+  virtual void Tick(float DeltaTime) override; // FTickableGameObject::
+  virtual auto GetStatId() const -> TStatId override;
+
+private:
+  struct PickRayRequest {
+    TWeakObjectPtr<class AAlkCharacter> Character;
+    FVector Start;
+    FVector End;
+    EAlkPointer Pointer;
+  };
+  struct PickRayInFlight {
+    TWeakObjectPtr<class AAlkCharacter> Character;
+    EAlkPointer Pointer;
+    FTraceHandle Handle;
+  };
+  TArray<PickRayRequest>  Requests;
+  TArray<PickRayInFlight> InFlight;
+};
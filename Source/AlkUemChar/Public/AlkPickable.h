@@ -0,0 +1,99 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Math/GenericOctree.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "AlkPickable.generated.h"
+
+// !!! opts its owner into registry picking: the bounds of the owner's root
+// !!! primitive are kept in the world's UAlkPickableRegistry as it moves
+UCLASS(ClassGroup = AlkCharacter, meta = (BlueprintSpawnableComponent))
+class ALKUEMCHAR_API UAlkPickableComponent : public UActorComponent
+{
+  GENERATED_BODY()
+
+public:
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    float AlkPickPaddingCm = 0.f; // !!! grows the bounds sphere to forgive aim
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    bool bAlkPickPrecise = false;
+      // ^ !!! confirms a candidate with a trace against this primitive only
+
+  auto GetPickPrimitive() const -> UPrimitiveComponent *;
+
+  FOctreeElementId2 OctreeId; // !!! maintained by UAlkPickableRegistry
+
+protected:
+  virtual void OnRegister()   override; // UActorComponent::
+  virtual void OnUnregister() override; // UActorComponent::
+
+private:
+  void OnPickPrimitiveMoved(
+    USceneComponent * component,
+    EUpdateTransformFlags flags,
+    ETeleportType teleport);
+
+  TWeakObjectPtr<UPrimitiveComponent> PickPrimitive;
+  FDelegateHandle MovedHandle;
+};
+
+struct FAlkPickableElement {
+  UAlkPickableComponent * Pickable = nullptr;
+  FBoxCenterAndExtent Bounds;
+  FVector Center = FVector::ZeroVector;
+  float Radius = 0.f;
+};
+
+struct FAlkPickableOctreeSemantics {
+  enum { MaxElementsPerLeaf = 16 };
+  enum { MinInclusiveElementsPerNode = 7 };
+  enum { MaxNodeDepth = 12 };
+  typedef TInlineAllocator<MaxElementsPerLeaf> ElementAllocator;
+
+  static auto GetBoundingBox(FAlkPickableElement const & element)
+    -> FBoxCenterAndExtent const & { return element.Bounds; }
+  static auto AreElementsEqual(
+    FAlkPickableElement const & a, FAlkPickableElement const & b) -> bool {
+    return a.Pickable == b.Pickable;
+  }
+  static void SetElementId(
+    FAlkPickableElement const & element, FOctreeElementId2 id) {
+    element.Pickable->OctreeId = id;
+  }
+};
+
+// !!! a loose octree of the world's pickables, so gaze and pointer picks
+// !!! test a few hundred spheres instead of querying the physics scene
+UCLASS()
+class ALKUEMCHAR_API UAlkPickableRegistry : public UWorldSubsystem
+{
+  GENERATED_BODY()
+
+public:
+  void Add(UAlkPickableComponent & pickable);
+  void Update(UAlkPickableComponent & pickable); // !!! after it moved
+  void Remove(UAlkPickableComponent & pickable);
+
+  auto Pick( // !!! true and outHit filled when a pickable was picked
+    FVector const & start,
+    FVector const & direction,
+    float const range,
+    float const coneDegrees,  // !!! widens with distance, 0 for a ray
+    float const gazeRadius,   // !!! constant widening in cm
+    FHitResult & outHit) const -> bool;
+
+  auto Num() const -> int32 { return Count; }
+
+private:
+  TOctree2<FAlkPickableElement, FAlkPickableOctreeSemantics> Octree{
+    FVector::ZeroVector, HALF_WORLD_MAX};
+  int32 Count = 0;
+};
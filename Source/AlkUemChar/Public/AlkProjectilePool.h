@@ -0,0 +1,88 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/TimerHandle.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/Interface.h"
+
+#include "AlkProjectilePool.generated.h"
+
+UINTERFACE(BlueprintType)
+class ALKUEMCHAR_API UAlkPooledProjectile : public UInterface
+{
+  GENERATED_BODY()
+};
+
+// !!! implemented by projectiles that can be recycled instead of destroyed;
+// !!! on hit they call UAlkProjectilePool::AlkReleaseProjectile, the pool
+// !!! releases them itself once their class InitialLifeSpan ran out
+class ALKUEMCHAR_API IAlkPooledProjectile
+{
+  GENERATED_BODY()
+
+public:
+  UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = AlkCharacter)
+    void AlkOnProjectileAcquired(FVector const & Location, FRotator const & Rotation);
+  UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = AlkCharacter)
+    void AlkOnProjectileReleased();
+};
+
+// !!! per-world pool of projectile actors keyed on their class
+UCLASS()
+class ALKUEMCHAR_API UAlkProjectilePool : public UWorldSubsystem
+{
+  GENERATED_BODY()
+
+public:
+  void Prewarm(TSubclassOf<AActor> projectileClass, int const count);
+
+  auto Acquire(
+    TSubclassOf<AActor> projectileClass,
+    FVector const & location,
+    FRotator const & rotation,
+    AActor * owner,
+    APawn * instigator) -> AActor *;
+
+  UFUNCTION(BlueprintCallable, Category = AlkCharacter, meta = (WorldContext = "WorldContextObject"))
+    static void AlkReleaseProjectile(UObject const * WorldContextObject, AActor * Projectile);
+      // ^ destroys the projectile instead when it did not come from a pool
+
+  UFUNCTION(BlueprintCallable, Category = AlkCharacter)
+    int AlkPoolHighWaterMark(TSubclassOf<AActor> ProjectileClass) const;
+      // ^ most projectiles of this class ever in flight at once
+
+  void Release(AActor & projectile);
+  void LogHighWaterMarks() const;
+
+  virtual void Deinitialize() override; // USubsystem::
+
+private:
+  struct ClassPool {
+    TArray<TWeakObjectPtr<AActor>> Idle;
+    int InFlight = 0;
+    int HighWaterMark = 0;
+    int Spawned = 0;
+  };
+  TMap<TSubclassOf<AActor>, ClassPool> Pools;
+  TSet<TWeakObjectPtr<AActor>> Pooled;
+  TMap<TWeakObjectPtr<AActor>, FTimerHandle> InFlightActors;
+    // ^ !!! acquired, not released, with the timer standing in for
+    // !!! InitialLifeSpan
+
+  static auto PruneIdle(ClassPool & pool) -> int; // !!! live idle count
+  auto SpawnIdle(TSubclassOf<AActor> projectileClass) -> AActor *;
+  static void Activate(AActor & projectile, FRotator const & rotation);
+  static void Deactivate(AActor & projectile);
+  void ClearExpiry(FTimerHandle & expiry) const;
+  void OnProjectileExpired(TWeakObjectPtr<AActor> projectile);
+
+  UFUNCTION()
+    void OnProjectileDestroyed(AActor * projectile);
+      // ^ !!! destroyed from outside the pool, e.g. by a level unload
+};
@@ -0,0 +1,56 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "AlkTouchGesture.generated.h"
+
+UENUM(BlueprintType)
+enum class EAlkTouchGesture : uint8 {
+  Pan,    // !!! value is the source finger (or centroid) delta in pixels
+  Pinch,  // !!! value X is the change of finger spread in pixels
+  Rotate, // !!! value X is the twist, one full turn per viewport width
+  Tap,    // !!! Notify only
+  Hold,   // !!! Notify only
+};
+// !!! Pinch and Rotate measure the two pressed fingers with the lowest
+// !!! ETouchIndex, any further fingers only count toward Fingers
+
+UENUM(BlueprintType)
+enum class EAlkTouchGestureAction : uint8 {
+  None,
+  Move,     // !!! DragMoveByViewportDelta
+  Turn,     // !!! DragTurnByViewportDelta
+  TurnYaw,  // !!! DragTurnByViewportDelta, horizontal only
+  Zoom,     // !!! follow boom arm length
+  Notify,   // !!! AlkOnTouchGesture delegates only
+};
+
+// !!! one row of the gesture table: with exactly Fingers pressed (0 for
+// !!! any count), RequiredTouches all pressed and none of ExcludedTouches,
+// !!! the recognized Gesture drives Action once per frame
+USTRUCT(BlueprintType)
+struct ALKUEMCHAR_API FAlkTouchGestureBinding
+{
+  GENERATED_BODY()
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    int32 Fingers = 1;
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    EAlkTouchGesture Gesture = EAlkTouchGesture::Pan;
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    EAlkTouchGestureAction Action = EAlkTouchGestureAction::None;
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    int32 SourceFinger = -1; // !!! Pan only: nth pressed finger, -1 centroid
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    int32 SourceTouch = -1; // !!! Pan only: ETouchIndex, overrides SourceFinger
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    int32 RequiredTouches = 0; // !!! bit per ETouchIndex
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AlkCharacter)
+    int32 ExcludedTouches = 0; // !!! bit per ETouchIndex
+};
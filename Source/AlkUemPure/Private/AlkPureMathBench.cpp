@@ -0,0 +1,93 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+// Microbenchmark of the batch conversions in AlkPureMath.h against the
+// scalar one-at-a-time loop, e.g.
+//   alk.Bench.PureMath 10000 1000
+//
+#include "AlkPureMath.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAlkBench, Log, All);
+
+struct AlkPureMathBench {
+  TArray<FVector2D> Vectors2D;
+  TArray<FVector> Vectors;
+  TArray<FVector::FReal> Xs, Ys;
+  int32 Iterations = 1;
+  double Checksum = 0.0; // !!! keeps the optimizer from dropping the work
+
+  AlkPureMathBench(int32 const count, int32 const iterations)
+    : Iterations(iterations) {
+    Vectors2D.SetNumUninitialized(count);
+    Vectors.SetNumUninitialized(count);
+    Xs.SetNumUninitialized(count);
+    Ys.SetNumUninitialized(count);
+    FRandomStream random(count);
+    for (auto & v : Vectors2D)
+      v = FVector2D(random.FRandRange(-1e4f, 1e4f), random.FRandRange(-1e4f, 1e4f));
+  }
+
+  template<typename Body>
+  auto Measure(TCHAR const * name, Body body) -> double {
+    auto const start = FPlatformTime::Cycles64();
+    for (auto i = 0; i < Iterations; ++i)
+      body();
+    auto const cycles = FPlatformTime::Cycles64() - start;
+    Checksum += Vectors.Last().X + Vectors2D.Last().Y + Xs.Last() + Ys.Last();
+    auto const nanos = FPlatformTime::ToMilliseconds64(cycles) * 1e6
+      / (double(Iterations) * Vectors.Num());
+    UE_LOG(LogAlkBench, Display, TEXT("%-28s %8.3f ns/element"), name, nanos);
+    return nanos;
+  }
+
+  void Run() {
+    auto const n = Vectors.Num();
+    auto const scalarTo3D = Measure(TEXT("scalar VectorFromVector2D"), [&] {
+      for (auto i = 0; i < n; ++i)
+        Vectors[i] = pure::VectorFromVector2D(Vectors2D[i]);
+    });
+    auto const batchTo3D = Measure(TEXT("batch VectorsFromVectors2D"), [&] {
+      pure::VectorsFromVectors2D(Vectors2D, Vectors);
+    });
+    auto const scalarTo2D = Measure(TEXT("scalar Vector2DFromVector"), [&] {
+      for (auto i = 0; i < n; ++i)
+        Vectors2D[i] = pure::Vector2DFromVector(Vectors[i]);
+    });
+    auto const batchTo2D = Measure(TEXT("batch Vectors2DFromVectors"), [&] {
+      pure::Vectors2DFromVectors(Vectors, Vectors2D);
+    });
+    Measure(TEXT("SoA2DFromVectors"), [&] {
+      pure::SoA2DFromVectors(Vectors, Xs, Ys);
+    });
+    Measure(TEXT("VectorsFromSoA2D"), [&] {
+      pure::VectorsFromSoA2D(Xs, Ys, Vectors);
+    });
+    UE_LOG(LogAlkBench, Display,
+      TEXT("%d elements x %d: to 3D %.2fx, to 2D %.2fx (checksum %f)"),
+      n, Iterations,
+      batchTo3D > 0.0 ? scalarTo3D / batchTo3D : 0.0,
+      batchTo2D > 0.0 ? scalarTo2D / batchTo2D : 0.0,
+      Checksum);
+  }
+};
+
+static FAutoConsoleCommand AlkBenchPureMathCommand(
+  TEXT("alk.Bench.PureMath"),
+  TEXT("alk.Bench.PureMath [elements] [iterations]"),
+  FConsoleCommandWithArgsDelegate::CreateLambda(
+    [](TArray<FString> const & args) {
+      auto const count = args.Num() > 0 ? FMath::Max(2, FCString::Atoi(*args[0])) : 10000;
+      auto const iterations = args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*args[1])) : 1000;
+      AlkPureMathBench(count, iterations).Run();
+    }));
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,94 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#include "AlkPureViewport.h"
+
+#include "Engine/Engine.h"
+#include "UnrealClient.h"
+#include "UObject/ObjectKey.h"
+
+#include "AlkPureWorld.h"
+
+namespace pure {
+
+namespace {
+
+struct WorldViewportEntry {
+  ViewportMetrics Metrics;
+  uint64 MouseOverFrame = MAX_uint64;
+  bool bStale = true;
+};
+
+// !!! game thread only, like the viewports themselves
+TMap<TObjectKey<UWorld>, WorldViewportEntry> WorldViewportEntries;
+uint32 NextViewportVersion = 1;
+FDelegateHandle ViewportResizedHandle;
+FDelegateHandle WorldCleanupHandle;
+ViewportMetrics const NoViewportMetrics;
+
+void OnViewportResized(FViewport *const, uint32) {
+  // !!! few worlds have viewports, so simply re-measure all of them lazily
+  for (auto & pair : WorldViewportEntries)
+    pair.Value.bStale = true;
+}
+
+void OnWorldCleanup(UWorld *const world, bool, bool) {
+  WorldViewportEntries.Remove(world);
+}
+
+void MeasureWorldViewport(
+  UWorld const *const world,
+  WorldViewportEntry & entry
+) {
+  auto const viewport = world->GetGameViewport();
+  if (!viewport)
+    return; // !!! stays stale until the game viewport exists
+  FVector2D size;
+  viewport->GetViewportSize(size);
+  auto const dpiScale = viewport->GetDPIScale();
+  entry.bStale = size.IsZero();
+  auto & metrics = entry.Metrics;
+  if (   metrics.Version != 0
+      && metrics.Size == size && metrics.DPIScale == dpiScale)
+    return;
+  metrics.Size = size;
+  metrics.Divisor = ViewportDivisorFromSize(size);
+  metrics.DPIScale = dpiScale;
+  metrics.Version = NextViewportVersion++;
+}
+
+}; // end namespace
+
+auto WorldGameViewportMetrics(
+  UWorld const *const world
+) -> ViewportMetrics const & {
+  check(IsInGameThread());
+  if (!world)
+    return NoViewportMetrics;
+  auto & entry = WorldViewportEntries.FindOrAdd(world);
+  if (entry.bStale)
+    MeasureWorldViewport(world, entry);
+  if (entry.MouseOverFrame != GFrameCounter) {
+    entry.MouseOverFrame = GFrameCounter;
+    entry.Metrics.bMouseOverClient = WorldGameViewportIsMouseOverClient(world);
+  }
+  return entry.Metrics;
+}
+
+void ViewportMetricsStartup() {
+  ViewportResizedHandle =
+    FViewport::ViewportResizedEvent.AddStatic(&OnViewportResized);
+  WorldCleanupHandle =
+    FWorldDelegates::OnWorldCleanup.AddStatic(&OnWorldCleanup);
+}
+
+void ViewportMetricsShutdown() {
+  FViewport::ViewportResizedEvent.Remove(ViewportResizedHandle);
+  FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+  WorldViewportEntries.Empty();
+}
+
+}; // end namespace pure
@@ -7,4 +7,14 @@
 #include "AlkUemPure.h"
 #include "Modules/ModuleManager.h"
 
-IMPLEMENT_GAME_MODULE(FDefaultGameModuleImpl, AlkUemPure);
+#include "AlkPureViewport.h"
+
+void FAlkUemPureModule::StartupModule() {
+  pure::ViewportMetricsStartup();
+}
+
+void FAlkUemPureModule::ShutdownModule() {
+  pure::ViewportMetricsShutdown();
+}
+
+IMPLEMENT_GAME_MODULE(FAlkUemPureModule, AlkUemPure);
@@ -0,0 +1,148 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+// Headless, no XR runtime needed, e.g.
+//   UnrealEditor-Cmd Game.uproject -nullrhi -unattended
+//     -ExecCmds="Automation RunTests Alk.Pure.HMD; Quit"
+//
+#include "AlkPureHMD.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+
+constexpr float SampleSeconds = 1.f;
+
+// !!! one pose per sample, Position in cm and Orientation in degrees
+auto Pose(float const x, float const yaw = 0.f) -> pure::HMDPose {
+  pure::HMDPose pose;
+  pose.Position = FVector(x, 0.f, 160.f);
+  pose.Orientation = FRotator(0.f, yaw, 0.f);
+  return pose;
+}
+
+struct Run {
+  pure::HMDSimulatedPoseSource Source;
+  pure::HMDMotionDetector Detector;
+  TArray<bool> Worn;        // !!! bWorn after each sample
+  TArray<bool> Transitions; // !!! what Update() returned
+
+  void Feed(TArray<pure::HMDPose> const & poses) {
+    Source.Poses.Append(poses);
+    for (auto i = 0; i < poses.Num(); ++i) {
+      pure::HMDPose pose;
+      auto const bHasPose = Source.ReadPose(pose);
+      Transitions.Add(Detector.Update(bHasPose, pose, SampleSeconds));
+      Worn.Add(Detector.bWorn);
+    }
+  }
+
+  auto Count(bool const value) const -> int32 {
+    return Transitions.FilterByPredicate(
+      [value](bool const t) { return t == value; }).Num();
+  }
+};
+
+auto Repeat(pure::HMDPose const & pose, int32 const n) -> TArray<pure::HMDPose> {
+  TArray<pure::HMDPose> poses;
+  poses.Init(pose, n);
+  return poses;
+}
+
+auto Jitter(
+  int32 const n,
+  float const x = 0.f,
+  float const yaw = 0.f
+) -> TArray<pure::HMDPose> {
+  // !!! alternates within the default 0.5 cm / 0.5 degree noise floor
+  TArray<pure::HMDPose> poses;
+  for (auto i = 0; i < n; ++i)
+    poses.Add(i & 1
+      ? Pose(x + 0.3f, yaw - 0.3f)
+      : Pose(x - 0.3f, yaw + 0.3f));
+  return poses;
+}
+
+auto Moving(int32 const n) -> TArray<pure::HMDPose> {
+  TArray<pure::HMDPose> poses;
+  for (auto i = 1; i <= n; ++i)
+    poses.Add(Pose(2.f * i, 3.f * i));
+  return poses;
+}
+
+}; // end anonymous namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlkPureHMDStillTest,
+  "Alk.Pure.HMD.MotionDetector.Still",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+auto FAlkPureHMDStillTest::RunTest(FString const & Parameters) -> bool {
+  Run run;
+  run.Feed(Repeat(Pose(0.f), 30));
+  TestEqual(TEXT("a still HMD never counts as worn"), run.Count(true), 0);
+  TestFalse(TEXT("not worn"), run.Detector.bWorn);
+  TestTrue(TEXT("anchored on the first pose"), run.Detector.bAnchored);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlkPureHMDJitterTest,
+  "Alk.Pure.HMD.MotionDetector.Jitter",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+auto FAlkPureHMDJitterTest::RunTest(FString const & Parameters) -> bool {
+  Run run;
+  run.Feed(Repeat(Pose(0.f), 1));
+  run.Feed(Jitter(30));
+  TestEqual(TEXT("jitter below the noise floor never puts it on"),
+    run.Count(true), 0);
+  // !!! once worn, jitter counts as still: it neither flips the state
+  // !!! back and forth nor keeps it worn forever
+  Run worn;
+  worn.Feed(Repeat(Pose(0.f), 1));
+  worn.Feed(Moving(3));
+  auto const stillLimit =
+    int32(worn.Detector.UnwornAfterStillSeconds / SampleSeconds);
+  worn.Transitions.Reset();
+  worn.Worn.Reset();
+  worn.Feed(Jitter(stillLimit - 1, 6.f, 9.f)); // !!! around the last move
+  TestEqual(TEXT("worn jitter flips nothing"), worn.Count(true), 0);
+  TestTrue(TEXT("still worn before the still timeout"), worn.Detector.bWorn);
+  worn.Feed(Repeat(Pose(6.f, 9.f), 1));
+  TestEqual(TEXT("taken off once the timeout elapsed"), worn.Count(true), 1);
+  TestFalse(TEXT("not worn after the timeout"), worn.Detector.bWorn);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlkPureHMDHysteresisTest,
+  "Alk.Pure.HMD.MotionDetector.Hysteresis",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+auto FAlkPureHMDHysteresisTest::RunTest(FString const & Parameters) -> bool {
+  Run run;
+  run.Feed(Repeat(Pose(0.f), 1));
+  TestFalse(TEXT("anchoring alone is not wearing"), run.Detector.bWorn);
+  run.Feed(Moving(5));
+  TestTrue(TEXT("worn on the first move beyond the floor"), run.Worn[1]);
+  TestEqual(TEXT("put on exactly once while moving"), run.Count(true), 1);
+  auto const stillLimit =
+    int32(run.Detector.UnwornAfterStillSeconds / SampleSeconds);
+  run.Feed(Repeat(Pose(10.f, 15.f), stillLimit - 1));
+  TestTrue(TEXT("stays worn while still below the timeout"), run.Detector.bWorn);
+  run.Feed(Repeat(Pose(10.f, 15.f), 1));
+  TestFalse(TEXT("taken off at the timeout"), run.Detector.bWorn);
+  TestEqual(TEXT("put on then taken off"), run.Count(true), 2);
+  run.Feed(Moving(1));
+  TestTrue(TEXT("put on again by motion"), run.Detector.bWorn);
+  run.Source.bAvailable = false;
+  run.Feed(Repeat(Pose(0.f), 1));
+  TestFalse(TEXT("no HMD is not worn"), run.Detector.bWorn);
+  TestFalse(TEXT("no HMD drops the anchor"), run.Detector.bAnchored);
+  return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,163 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+// Headless, checks pure::ViewProjection against the FSceneView statics, e.g.
+//   UnrealEditor-Cmd Game.uproject -nullrhi -unattended
+//     -ExecCmds="Automation RunTests Alk.Pure.View; Quit"
+//
+#include "AlkPureView.h"
+
+#include "Math/OrthoMatrix.h"
+#include "Math/PerspectiveMatrix.h"
+#include "Math/RotationMatrix.h"
+#include "Math/TranslationMatrix.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+
+FIntRect const ViewRect(40, 20, 40 + 1280, 20 + 720); // !!! offset as in split screen
+FVector const ViewLocation(120.0, -340.0, 170.0);
+FRotator const ViewRotation(-12.0, 35.0, 0.0);
+
+auto ViewMatrix() -> FMatrix {
+  // !!! as FMinimalViewInfo: translate, rotate, then swap to view axes
+  return FTranslationMatrix(-ViewLocation)
+    * FInverseRotationMatrix(ViewRotation)
+    * FMatrix(
+        FPlane(0, 0, 1, 0),
+        FPlane(1, 0, 0, 0),
+        FPlane(0, 1, 0, 0),
+        FPlane(0, 0, 0, 1));
+}
+
+auto Perspective() -> FMatrix {
+  return ViewMatrix() * FReversedZPerspectiveMatrix(
+    FMath::DegreesToRadians(45.0), ViewRect.Width(), ViewRect.Height(), 10.0);
+}
+
+auto Orthographic() -> FMatrix {
+  auto constexpr nearPlane = 0.0, farPlane = 20000.0;
+  return ViewMatrix() * FReversedZOrthoMatrix(
+    800.0, 800.0 * ViewRect.Height() / ViewRect.Width(),
+    1.0 / (farPlane - nearPlane), -nearPlane);
+}
+
+auto ScreenGrid() -> TArray<FVector2D> {
+  TArray<FVector2D> screen;
+  for (auto y = 0; y <= 4; ++y)
+    for (auto x = 0; x <= 4; ++x)
+      screen.Add(FVector2D(
+        ViewRect.Min.X + ViewRect.Width() * x / 4.0,
+        ViewRect.Min.Y + ViewRect.Height() * y / 4.0));
+  return screen;
+}
+
+auto WorldPoints() -> TArray<FVector> {
+  // !!! in front of the view at several depths, then behind it
+  auto const forward = ViewRotation.Vector();
+  auto const right = FRotationMatrix(ViewRotation).GetUnitAxis(EAxis::Y);
+  auto const up = FRotationMatrix(ViewRotation).GetUnitAxis(EAxis::Z);
+  TArray<FVector> world;
+  for (auto const depth : {50.0, 400.0, 3000.0, -200.0})
+    for (auto const side : {-0.3, 0.0, 0.25})
+      world.Add(ViewLocation + forward * depth
+        + right * side * FMath::Abs(depth) + up * side * 0.5 * FMath::Abs(depth));
+  return world;
+}
+
+void CheckAgainstSceneView(
+  FAutomationTestBase & test,
+  TCHAR const * const what,
+  FMatrix const & viewProjection,
+  bool const bPerspective
+) {
+  auto const view = pure::ViewProjection::FromMatrix(ViewRect, viewProjection);
+  // !!! deproject matches FSceneView::DeprojectScreenToWorld
+  auto const screen = ScreenGrid();
+  TArray<FVector> origins, directions;
+  origins.SetNum(screen.Num());
+  directions.SetNum(screen.Num());
+  test.TestEqual(FString::Printf(TEXT("%s deprojects every point"), what),
+    view.Deproject(screen, origins, directions), screen.Num());
+  for (auto i = 0; i < screen.Num(); ++i) {
+    FVector origin, direction;
+    FSceneView::DeprojectScreenToWorld(screen[i], ViewRect,
+      viewProjection.Inverse(), origin, direction);
+    test.TestTrue(FString::Printf(TEXT("%s origin %d"), what, i),
+      origins[i].Equals(origin, 1e-3));
+    test.TestTrue(FString::Printf(TEXT("%s direction %d"), what, i),
+      directions[i].Equals(direction, 1e-6));
+  }
+  // !!! project matches FSceneView::ProjectWorldToScreen, behind included
+  auto const world = WorldPoints();
+  TArray<FVector2D> projected;
+  TArray<bool> inFront;
+  projected.SetNum(world.Num());
+  inFront.SetNum(world.Num());
+  test.TestEqual(FString::Printf(TEXT("%s projects every point"), what),
+    view.Project(world, projected, inFront), world.Num());
+  for (auto i = 0; i < world.Num(); ++i) {
+    FVector2D reference;
+    auto const bReference = FSceneView::ProjectWorldToScreen(
+      world[i], ViewRect, viewProjection, reference);
+    test.TestEqual(FString::Printf(TEXT("%s in front %d"), what, i),
+      inFront[i], bReference);
+    if (!bReference) {
+      test.TestTrue(FString::Printf(TEXT("%s behind is zero %d"), what, i),
+        projected[i].IsZero());
+      continue;
+    }
+    test.TestTrue(FString::Printf(TEXT("%s screen %d"), what, i),
+      projected[i].Equals(reference, 1e-3));
+    // !!! round trip: the point lies on the ray deprojected from its screen
+    FVector origin, direction;
+    view.Deproject(projected[i], origin, direction);
+    test.TestTrue(FString::Printf(TEXT("%s round trip %d"), what, i),
+      FMath::PointDistToLine(world[i], direction, origin) < 1e-2);
+  }
+  if (bPerspective) {
+    auto const behind = ViewLocation - ViewRotation.Vector() * 100.0;
+    FVector2D unused;
+    test.TestFalse(FString::Printf(TEXT("%s behind the camera"), what),
+      view.Project(behind, unused));
+  }
+}
+
+}; // end anonymous namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlkPureViewPerspectiveTest,
+  "Alk.Pure.View.Perspective",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+auto FAlkPureViewPerspectiveTest::RunTest(FString const & Parameters) -> bool {
+  CheckAgainstSceneView(*this, TEXT("perspective"), Perspective(), true);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlkPureViewOrthographicTest,
+  "Alk.Pure.View.Orthographic",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+auto FAlkPureViewOrthographicTest::RunTest(FString const & Parameters) -> bool {
+  CheckAgainstSceneView(*this, TEXT("orthographic"), Orthographic(), false);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlkPureViewInvalidTest,
+  "Alk.Pure.View.Invalid",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+auto FAlkPureViewInvalidTest::RunTest(FString const & Parameters) -> bool {
+  pure::ViewProjection const view; // !!! e.g. no local player
+  FVector origin, direction;
+  TestFalse(TEXT("an empty view deprojects nothing"),
+    view.Deproject(FVector2D(10.0, 10.0), origin, direction));
+  return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
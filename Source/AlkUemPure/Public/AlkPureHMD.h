@@ -0,0 +1,85 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace pure {
+
+struct HMDPose {
+  FRotator Orientation = FRotator::ZeroRotator;
+  FVector  Position    = FVector::ZeroVector;
+};
+
+// !!! anything that yields HMD poses, e.g. the XR system or a simulation
+struct HMDPoseSource {
+  virtual ~HMDPoseSource() {}
+  virtual auto ReadPose(HMDPose & outPose) -> bool = 0;
+    // ^ false when no HMD is available
+};
+
+// !!! replays scripted poses so presence can be exercised without XR
+struct HMDSimulatedPoseSource : HMDPoseSource {
+  TArray<HMDPose> Poses;
+  int Next = 0;
+  bool bAvailable = true;
+
+  virtual auto ReadPose(HMDPose & outPose) -> bool override {
+    if (!bAvailable || Poses.Num() == 0)
+      return false;
+    outPose = Poses[FMath::Min(Next, Poses.Num() - 1)];
+    if (Next < Poses.Num())
+      ++Next;
+    return true;
+  }
+};
+
+// !!! decides whether an HMD is worn from its motion, with hysteresis:
+// !!! motion beyond the noise floor relative to the last anchored pose
+// !!! means worn, only staying still long enough means not worn
+struct HMDMotionDetector {
+  float NoiseFloorCm = 0.5f;
+  float NoiseFloorDegrees = 0.5f;
+  float UnwornAfterStillSeconds = 10.f;
+  HMDPose Anchor;
+  float StillSeconds = 0.f;
+  bool bAnchored = false;
+  bool bWorn = false;
+
+  auto Update( // returns true when bWorn changed
+    bool const bHasPose,
+    HMDPose const & pose,
+    float const deltaSeconds
+  ) -> bool {
+    auto const wasWorn = bWorn;
+    if (!bHasPose) {
+      bAnchored = false;
+      bWorn = false;
+    } else if (!bAnchored) {
+      Anchor = pose;
+      bAnchored = true;
+      StillSeconds = 0.f;
+    } else if (
+           FVector::DistSquared(pose.Position, Anchor.Position)
+             > FMath::Square(NoiseFloorCm)
+        || FMath::RadiansToDegrees(
+             pose.Orientation.Quaternion().AngularDistance(
+               Anchor.Orientation.Quaternion()))
+             > NoiseFloorDegrees) {
+      Anchor = pose; // !!! re-anchor so slow drift still accumulates
+      StillSeconds = 0.f;
+      bWorn = true;
+    } else {
+      StillSeconds += deltaSeconds;
+      if (StillSeconds >= UnwornAfterStillSeconds)
+        bWorn = false;
+    }
+    return bWorn != wasWorn;
+  }
+};
+
+}; // end namespace pure
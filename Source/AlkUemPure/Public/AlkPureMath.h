@@ -4,14 +4,16 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 //
+#include "Containers/ArrayView.h"
 #include "Engine/GameViewportClient.h"
 #include "Engine/World.h"
+#include "Math/VectorRegister.h"
 
 namespace pure {
 
 inline auto VectorFromVector2D(
   FVector2D const & vec2D,
-  float z = 0.f
+  FVector::FReal z = 0.f // !!! not float, the batch tails pass FReal through
 ) -> FVector {
   return FVector(vec2D.X, vec2D.Y, z);
 }
@@ -22,4 +24,93 @@ inline auto Vector2DFromVector(
   return FVector2D(vec.X, vec.Y);
 }
 
+// !!! batch variants: each converts min(src, dst) elements and returns that
+// !!! count. The AoS ones go through the engine's VectorRegister4Double
+// !!! layer, i.e. SSE/AVX2 on x64 and NEON on Android, two vectors per step.
+// !!! The SoA ones are plain loops over separate component arrays, which
+// !!! the compiler vectorizes on its own.
+
+inline auto VectorsFromVectors2D(
+  TConstArrayView<FVector2D> const src,
+  TArrayView<FVector> const dst,
+  FVector::FReal z = 0.f
+) -> int32 {
+  auto const n = FMath::Min(src.Num(), dst.Num());
+  auto const zs = MakeVectorRegisterDouble(z, z, z, z);
+  auto i = 0;
+  for (; i + 1 < n; i += 2) {
+    auto const xyxy = VectorLoad(&src[i].X); // !!! X0 Y0 X1 Y1
+    VectorStoreFloat3(VectorShuffle(xyxy, zs, 0, 1, 0, 0), &dst[i].X);
+    VectorStoreFloat3(VectorShuffle(xyxy, zs, 2, 3, 0, 0), &dst[i + 1].X);
+  }
+  for (; i < n; ++i)
+    dst[i] = VectorFromVector2D(src[i], z);
+  return n;
+}
+
+inline auto Vectors2DFromVectors(
+  TConstArrayView<FVector> const src,
+  TArrayView<FVector2D> const dst
+) -> int32 {
+  auto const n = FMath::Min(src.Num(), dst.Num());
+  auto i = 0;
+  for (; i + 1 < n; i += 2) {
+    auto const a = VectorLoadFloat3(&src[i].X);
+    auto const b = VectorLoadFloat3(&src[i + 1].X);
+    VectorStore(VectorShuffle(a, b, 0, 1, 0, 1), &dst[i].X);
+  }
+  for (; i < n; ++i)
+    dst[i] = Vector2DFromVector(src[i]);
+  return n;
+}
+
+inline auto VectorsFromSoA2D(
+  TConstArrayView<FVector::FReal> const xs,
+  TConstArrayView<FVector::FReal> const ys,
+  TArrayView<FVector> const dst,
+  FVector::FReal z = 0.f
+) -> int32 {
+  auto const n = FMath::Min3(xs.Num(), ys.Num(), dst.Num());
+  for (auto i = 0; i < n; ++i)
+    dst[i] = FVector(xs[i], ys[i], z);
+  return n;
+}
+
+inline auto SoA2DFromVectors(
+  TConstArrayView<FVector> const src,
+  TArrayView<FVector::FReal> const xs,
+  TArrayView<FVector::FReal> const ys
+) -> int32 {
+  auto const n = FMath::Min3(src.Num(), xs.Num(), ys.Num());
+  for (auto i = 0; i < n; ++i) {
+    xs[i] = src[i].X;
+    ys[i] = src[i].Y;
+  }
+  return n;
+}
+
+inline auto SoA2DFromVectors2D(
+  TConstArrayView<FVector2D> const src,
+  TArrayView<FVector::FReal> const xs,
+  TArrayView<FVector::FReal> const ys
+) -> int32 {
+  auto const n = FMath::Min3(src.Num(), xs.Num(), ys.Num());
+  for (auto i = 0; i < n; ++i) {
+    xs[i] = src[i].X;
+    ys[i] = src[i].Y;
+  }
+  return n;
+}
+
+inline auto Vectors2DFromSoA2D(
+  TConstArrayView<FVector::FReal> const xs,
+  TConstArrayView<FVector::FReal> const ys,
+  TArrayView<FVector2D> const dst
+) -> int32 {
+  auto const n = FMath::Min3(xs.Num(), ys.Num(), dst.Num());
+  for (auto i = 0; i < n; ++i)
+    dst[i] = FVector2D(xs[i], ys[i]);
+  return n;
+}
+
 }; // end namespace pure
@@ -0,0 +1,143 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/PlayerController.h"
+#include "Math/VectorRegister.h"
+#include "SceneView.h"
+
+namespace pure {
+
+// !!! a view's projection captured once (e.g. per frame) and immutable after,
+// !!! so batches of screen points convert without a UWorld or a controller;
+// !!! the math mirrors FSceneView::DeprojectScreenToWorld/ProjectWorldToScreen
+struct ViewProjection {
+  FMatrix Matrix = FMatrix::Identity;
+  FMatrix InverseMatrix = FMatrix::Identity;
+  FIntRect ViewRect;
+
+  static auto FromMatrix(
+    FIntRect const & viewRect,
+    FMatrix const & viewProjectionMatrix
+  ) -> ViewProjection {
+    ViewProjection result;
+    result.Matrix = viewProjectionMatrix;
+    result.InverseMatrix = viewProjectionMatrix.Inverse();
+    result.ViewRect = viewRect;
+    return result;
+  }
+
+  auto IsValid() const -> bool {
+    return ViewRect.Area() > 0;
+  }
+
+  // !!! origins and directions receive min(screen, origins, directions)
+  // !!! elements; since screen X and Y enter the inverse projection
+  // !!! linearly, each point costs two multiply-adds per ray end
+  auto Deproject(
+    TConstArrayView<FVector2D> const screen,
+    TArrayView<FVector> const origins,
+    TArrayView<FVector> const directions
+  ) const -> int32 {
+    auto const n = FMath::Min3(screen.Num(), origins.Num(), directions.Num());
+    if (!IsValid())
+      return 0;
+    auto const & m = InverseMatrix.M;
+    auto const rowX = VectorLoad(m[0]);
+    auto const rowY = VectorLoad(m[1]);
+    auto const rowZ = VectorLoad(m[2]);
+    auto const rowW = VectorLoad(m[3]);
+    auto const nearBias = VectorAdd(rowZ, rowW); // !!! z = 1
+    auto const farBias = VectorMultiplyAdd( // !!! z = 0.01
+      VectorSetFloat1(0.01), rowZ, rowW);
+    auto const scale = FVector2D(2.0 / ViewRect.Width(), -2.0 / ViewRect.Height());
+    auto const offset = FVector2D(
+      -1.0 - ViewRect.Min.X * scale.X, 1.0 - ViewRect.Min.Y * scale.Y);
+    for (auto i = 0; i < n; ++i) {
+      auto const x = VectorSetFloat1(screen[i].X * scale.X + offset.X);
+      auto const y = VectorSetFloat1(screen[i].Y * scale.Y + offset.Y);
+      auto const xy = VectorMultiplyAdd(x, rowX, VectorMultiply(y, rowY));
+      auto nearH = VectorAdd(xy, nearBias);
+      auto farH  = VectorAdd(xy, farBias);
+      nearH = VectorDivide(nearH, VectorReplicate(nearH, 3));
+      farH  = VectorDivide(farH,  VectorReplicate(farH, 3));
+      VectorStoreFloat3(nearH, &origins[i].X);
+      VectorStoreFloat3(VectorSubtract(farH, nearH), &directions[i].X);
+      directions[i].Normalize();
+    }
+    return n;
+  }
+
+  auto Deproject(
+    FVector2D const & screen,
+    FVector & origin,
+    FVector & direction
+  ) const -> bool {
+    return Deproject(MakeArrayView(&screen, 1),
+      MakeArrayView(&origin, 1), MakeArrayView(&direction, 1)) == 1;
+  }
+
+  // !!! inFront is false for points behind the view, their screen is zero
+  auto Project(
+    TConstArrayView<FVector> const world,
+    TArrayView<FVector2D> const screen,
+    TArrayView<bool> const inFront
+  ) const -> int32 {
+    auto const n = FMath::Min3(world.Num(), screen.Num(), inFront.Num());
+    auto const & m = Matrix.M;
+    auto const rowX = VectorLoad(m[0]);
+    auto const rowY = VectorLoad(m[1]);
+    auto const rowZ = VectorLoad(m[2]);
+    auto const rowW = VectorLoad(m[3]);
+    auto const halfSize = FVector2D(ViewRect.Width(), ViewRect.Height()) * 0.5;
+    for (auto i = 0; i < n; ++i) {
+      auto const & p = world[i];
+      auto const h = VectorMultiplyAdd(VectorSetFloat1(p.X), rowX,
+                     VectorMultiplyAdd(VectorSetFloat1(p.Y), rowY,
+                     VectorMultiplyAdd(VectorSetFloat1(p.Z), rowZ, rowW)));
+      alignas(32) double xyzw[4];
+      VectorStoreAligned(h, xyzw);
+      inFront[i] = xyzw[3] > 0.0;
+      screen[i] = inFront[i]
+        ? FVector2D(
+            ViewRect.Min.X + (1.0 + xyzw[0] / xyzw[3]) * halfSize.X,
+            ViewRect.Min.Y + (1.0 - xyzw[1] / xyzw[3]) * halfSize.Y)
+        : FVector2D::ZeroVector;
+    }
+    return n;
+  }
+
+  auto Project(
+    FVector const & world,
+    FVector2D & screen
+  ) const -> bool {
+    bool inFront = false;
+    Project(MakeArrayView(&world, 1),
+      MakeArrayView(&screen, 1), MakeArrayView(&inFront, 1));
+    return inFront;
+  }
+};
+
+// !!! the one engine-facing capture, as UGameplayStatics::DeprojectScreenToWorld
+inline auto ViewProjectionFromPlayerController(
+  APlayerController const *const pc
+) -> ViewProjection {
+  auto const player = pc ? pc->GetLocalPlayer() : nullptr;
+  if (!player || !player->ViewportClient)
+    return ViewProjection();
+  FSceneViewProjectionData data;
+  if (!player->GetProjectionData(player->ViewportClient->Viewport,
+                                 data))
+    return ViewProjection();
+  return ViewProjection::FromMatrix(
+    data.GetConstrainedViewRect(), data.ComputeViewProjectionMatrix());
+}
+
+}; // end namespace pure
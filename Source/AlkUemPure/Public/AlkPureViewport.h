@@ -0,0 +1,40 @@
+// Copyright © 2025 Alkaline Games, LLC.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+namespace pure {
+
+// !!! a snapshot of one world's game viewport, Version changes only when
+// !!! Size or DPIScale change so derived values can be kept until then
+struct ViewportMetrics {
+  FVector2D Size = FVector2D::ZeroVector;
+  FVector2D Divisor = FVector2D::ZeroVector; // !!! larger side on both axes
+  float DPIScale = 1.f;
+  bool bMouseOverClient = false; // !!! refreshed at most once per frame
+  uint32 Version = 0; // !!! 0 until a viewport has been measured
+};
+
+inline auto ViewportDivisorFromSize(
+  FVector2D const & size
+) -> FVector2D {
+  return (size.X > size.Y)
+    ?  FVector2D(size.X, size.X)
+    :  FVector2D(size.Y, size.Y);
+}
+
+ALKUEMPURE_API auto WorldGameViewportMetrics(
+  UWorld const *const world
+) -> ViewportMetrics const &;
+
+ALKUEMPURE_API void ViewportMetricsStartup();
+ALKUEMPURE_API void ViewportMetricsShutdown();
+
+}; // end namespace pure